@@ -0,0 +1,152 @@
+/*----------------------------------------------------------------------------*/
+/** \file    ConnectivityCodec.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_CONNECTIVITYCODEC_H_
+#define GMDS_CONNECTIVITYCODEC_H_
+/*----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <vector>
+#include <stdint.h>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Compact encoding of cell to node connectivities.
+ *
+ *          Each node id is replaced by its difference with the previous id
+ *          of the stream, mapped to an unsigned integer by zigzag coding
+ *          (0,-1,1,-2... become 0,1,2,3...) and written as a variable-length
+ *          integer of 7 bits per byte, the high bit being set on all the
+ *          bytes but the last. In a mesh numbered along a space-filling
+ *          curve (see ERenumbering) most differences fit in one byte.
+ *
+ *          The streams are independent from each other, so that a
+ *          connectivity split in chunks can be encoded and decoded chunk by
+ *          chunk, in parallel.
+ */
+class ConnectivityCodec{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Append the encoding of the ANb ids of AIDs to AOut.
+	 */
+	template<typename TID>
+	static void encode(const TID* AIDs, const std::size_t ANb,
+					   std::vector<uint8_t>& AOut)
+	{
+		AOut.reserve(AOut.size()+ANb+ANb/4);
+		uint64_t previous = 0;
+		for(std::size_t i=0; i<ANb; i++) {
+			const uint64_t current = static_cast<uint64_t>(AIDs[i]);
+			const int64_t delta = static_cast<int64_t>(current-previous);
+			writeVarint(zigzag(delta),AOut);
+			previous = current;
+		}
+	}
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Decode ANb ids from the ASize bytes of AIn into AIDs.
+	 *
+	 *  \return the number of bytes read. Throws a GMDSException if AIn holds
+	 *  		less than ANb ids.
+	 */
+	template<typename TID>
+	static std::size_t decode(const uint8_t* AIn, const std::size_t ASize,
+							  const std::size_t ANb, TID* AIDs)
+	{
+		std::size_t pos = 0;
+		uint64_t previous = 0;
+		std::size_t i = 0;
+		// one byte differences first, without bound checks on each byte
+		// of a varint as long as the longest one fits in the buffer
+		while(i<ANb && pos+MAX_BYTES<=ASize) {
+			const uint8_t b = AIn[pos];
+			uint64_t value;
+			if(b < 0x80) {
+				value = b;
+				pos++;
+			}
+			else {
+				value = readVarintUnchecked(AIn,pos);
+			}
+			previous += static_cast<uint64_t>(unzigzag(value));
+			AIDs[i++] = static_cast<TID>(previous);
+		}
+		for(; i<ANb; i++) {
+			uint64_t value = 0;
+			int shift = 0;
+			for(;;) {
+				if(pos >= ASize) {
+					throw GMDSException("ConnectivityCodec::decode truncated stream");
+				}
+				const uint8_t b = AIn[pos++];
+				value |= static_cast<uint64_t>(b & 0x7f) << shift;
+				if(b < 0x80) {
+					break;
+				}
+				shift += 7;
+			}
+			previous += static_cast<uint64_t>(unzigzag(value));
+			AIDs[i] = static_cast<TID>(previous);
+		}
+		return pos;
+	}
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Encode a connectivity in CSR form, cells [AFirst, AFirst+ANb)
+	 *          of AOffsets/ANodes, as one stream appended to AOut.
+	 */
+	template<typename TOffset, typename TID>
+	static void encodeCells(const TOffset* AOffsets, const TID* ANodes,
+							const std::size_t AFirst, const std::size_t ANb,
+							std::vector<uint8_t>& AOut)
+	{
+		encode(ANodes+AOffsets[AFirst],AOffsets[AFirst+ANb]-AOffsets[AFirst],AOut);
+	}
+
+	/* maximal number of bytes of the encoding of an integer */
+	static const std::size_t MAX_BYTES = 10;
+
+	static uint64_t zigzag(const int64_t AValue) {
+		return (static_cast<uint64_t>(AValue) << 1) ^ static_cast<uint64_t>(AValue >> 63);
+	}
+
+	static int64_t unzigzag(const uint64_t AValue) {
+		return static_cast<int64_t>(AValue >> 1) ^ -static_cast<int64_t>(AValue & 1);
+	}
+
+	static void writeVarint(uint64_t AValue, std::vector<uint8_t>& AOut) {
+		while(AValue >= 0x80) {
+			AOut.push_back(static_cast<uint8_t>(AValue | 0x80));
+			AValue >>= 7;
+		}
+		AOut.push_back(static_cast<uint8_t>(AValue));
+	}
+
+private:
+
+	/* reads a varint at APos, the buffer must hold MAX_BYTES bytes from
+	 * APos */
+	static uint64_t readVarintUnchecked(const uint8_t* AIn, std::size_t& APos) {
+		uint64_t value = 0;
+		int shift = 0;
+		for(std::size_t k=0; k<MAX_BYTES; k++) {
+			const uint8_t b = AIn[APos++];
+			value |= static_cast<uint64_t>(b & 0x7f) << shift;
+			if(b < 0x80) {
+				return value;
+			}
+			shift += 7;
+		}
+		throw GMDSException("ConnectivityCodec::decode invalid stream");
+	}
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_CONNECTIVITYCODEC_H_
+/*----------------------------------------------------------------------------*/
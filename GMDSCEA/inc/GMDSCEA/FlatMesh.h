@@ -0,0 +1,111 @@
+/*----------------------------------------------------------------------------*/
+/** \file    FlatMesh.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_FLATMESH_H_
+#define GMDS_FLATMESH_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include <Lima/lima++.h>
+#include "GMDSCEA/SoAMeshView.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Mesh stored as flat arrays, filled by LimaFlatReader.
+ *
+ *          Nodes and cells are designated by their index, from 0: the
+ *          coordinates are x, y and z, the cells of dimension d (1, 2 or 3)
+ *          are in CSR form in cells[d] and the groups of dimension d (0 to
+ *          3) are in CSR form in groups[d]. The ids of the file are kept in
+ *          the ids arrays.
+ */
+struct FlatMesh {
+
+	struct Cells {
+		std::vector<std::size_t> offsets;
+		std::vector<std::size_t> nodes;
+		std::vector<gmds::ECellType> types;
+		std::vector<Lima::id_type> ids;
+	};
+
+	struct Groups {
+		std::vector<std::string> names;
+		std::vector<std::size_t> offsets;
+		std::vector<std::size_t> cells;
+	};
+
+	FlatMesh():dim(3),lengthUnit(1.) {}
+
+	int dim;
+
+	double lengthUnit;
+
+	std::vector<double> x;
+	std::vector<double> y;
+	std::vector<double> z;
+	std::vector<Lima::id_type> nodeIDs;
+
+	/* cells[0] is not used */
+	Cells cells[4];
+
+	Groups groups[4];
+
+	/* empty all the arrays, their capacity is kept */
+	void clear() {
+		x.clear();
+		y.clear();
+		z.clear();
+		nodeIDs.clear();
+		for(int d=0; d<4; d++) {
+			cells[d].offsets.clear();
+			cells[d].nodes.clear();
+			cells[d].types.clear();
+			cells[d].ids.clear();
+			groups[d].names.clear();
+			groups[d].offsets.clear();
+			groups[d].cells.clear();
+		}
+	}
+
+	/* number of cells of dimension ADim (1, 2 or 3) */
+	std::size_t getNbCells(int ADim) const {
+		return cells[ADim].types.size();
+	}
+
+	/* view on the arrays, valid while they are not modified */
+	SoAMeshView view() const {
+		SoAMeshView v;
+		v.dim = dim;
+		v.nbNodes = x.size();
+		v.x = x.empty()?0:&x[0];
+		v.y = y.empty()?0:&y[0];
+		v.z = z.empty()?0:&z[0];
+		for(int d=1; d<4; d++) {
+			const Cells& c = cells[d];
+			SoAMeshView::Cells vc = {c.types.size(),
+					c.offsets.empty()?0:&c.offsets[0],
+					c.nodes.empty()?0:&c.nodes[0],
+					c.types.empty()?0:&c.types[0]};
+			v.cells[d] = vc;
+		}
+		for(int d=0; d<4; d++) {
+			const Groups& g = groups[d];
+			for(std::size_t i=0; i<g.names.size(); i++) {
+				SoAMeshView::Group vg = {g.names[i], g.offsets[i+1]-g.offsets[i],
+						g.cells.empty()?0:&g.cells[0]+g.offsets[i]};
+				v.groups[d].push_back(vg);
+			}
+		}
+		return v;
+	}
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_FLATMESH_H_
+/*----------------------------------------------------------------------------*/
@@ -7,8 +7,14 @@
 #ifndef GMDS_GMDSCEAWRITER_H_
 #define GMDS_GMDSCEAWRITER_H_
 /*----------------------------------------------------------------------------*/
+#include <string>
+/*----------------------------------------------------------------------------*/
 #include <GMDS/IG/IG.h>
 /*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaStager.h"
+#include "GMDSCEA/MeshStatistics.h"
+#include "GMDSCEA/WriterOptions.h"
+/*----------------------------------------------------------------------------*/
 namespace gmds{
 /*----------------------------------------------------------------------------*/
 class GMDSCEAWriter{
@@ -30,6 +36,44 @@ public:
 	 */
 	void setLengthUnit(double AUnit);
 
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the storage options used for the mli2 format, see
+	 *          WriterOptions. They are ignored by the other formats.
+	 */
+	void setOptions(const WriterOptions& AOptions);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Skip the writes of a mesh that did not change.
+	 *
+	 *          When activated, a hash of the mesh content (see MeshHash) is
+	 *          computed and stored in the metadata of the file written (see
+	 *          LimaMetaFile). A write is skipped if the file already holds
+	 *          the same content, and replaced by a hard link to the previous
+	 *          file written by this writer if it holds the same content.
+	 */
+	void setSkipUnchanged(bool ASkip);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Whether the last call to write did not write the mesh
+	 *          because it was unchanged.
+	 */
+	bool isLastWriteSkipped() const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Write the files in the scratch directory of AStager, which
+	 *          moves them to their path in the background; 0 (the default)
+	 *          writes them in place. AStager is not owned by the writer, its
+	 *          barrier tells when the files are at their path.
+	 */
+	void setStaging(LimaStager* AStager);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Statistics of the mesh of the last write in the mli2 format,
+	 *          see LimaWriterAPI::getStatistics. When the write was skipped,
+	 *          they are read from the metadata of the file if they are there.
+	 */
+	const MeshStatistics& getStatistics() const;
+
     /*------------------------------------------------------------------------*/
     /** \brief  Write the content of mesh_ into the file named AFileName.
      */
@@ -37,11 +81,48 @@ public:
 
 protected:
 
+	/*------------------------------------------------------------------------*/
+	/** \brief  Write the file, whatever its content.
+	 */
+	void writeFile(const std::string& AFileName, gmds::MeshModel AModel, int ACompact);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Path where the file AFileName is written, in the scratch
+	 *          directory when staging, and queue of its move to AFileName.
+	 */
+	std::string stage(const std::string& AFileName);
+	void unstage(const std::string& ATarget, const std::string& AFileName);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Hash of what write would put in the file AFileName: the mesh
+	 *          content, the format given by the suffix of AFileName and the
+	 *          writing parameters.
+	 */
+	std::string computeHash(const std::string& AFileName, gmds::MeshModel AModel,
+			int ACompact) const;
+
 	/* a mesh */
 	gmds::IGMesh& mesh_;
 
 	/* length unit */
 	double lenghtUnit_;
+
+	/* storage options of the mli2 format */
+	WriterOptions options_;
+
+	/* skip of the unchanged writes */
+	bool skipUnchanged_;
+	bool lastSkipped_;
+
+	/* last file written and hash of its content */
+	std::string lastFile_;
+	std::string lastHash_;
+
+	/* statistics of the last write */
+	MeshStatistics stats_;
+
+	/* staging of the files written, 0 if none */
+	LimaStager* stager_;
 };
 /*----------------------------------------------------------------------------*/
 }  // namespace gmds
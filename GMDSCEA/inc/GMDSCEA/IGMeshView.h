@@ -0,0 +1,89 @@
+/*----------------------------------------------------------------------------*/
+/** \file    IGMeshView.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_IGMESHVIEW_H_
+#define GMDS_IGMESHVIEW_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include <Lima/lima++.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Mesh view (see SoAMeshView) of a gmds::IGMesh, so that an IGMesh
+ *          can be written by LimaViewWriter.
+ *
+ *          The nodes and cells are indexed in container order, holes being
+ *          skipped. Only the ids are copied, the connectivity and the
+ *          coordinates are read from the mesh.
+ */
+class IGMeshView{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor.
+	 *
+	 *  \param AMesh the viewed mesh, it must not be modified while the view
+	 *  	   is used.
+	 */
+	IGMeshView(gmds::IGMesh& AMesh);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor.	*/
+	virtual ~IGMeshView();
+
+	/*------------------------------------------------------------------------*/
+	/* mesh view interface */
+
+	int getDim() const;
+
+	std::size_t getNbNodes() const;
+
+	void getCoordinates(std::size_t AFirst, std::size_t ANb,
+			double* AX, double* AY, double* AZ) const;
+
+	std::size_t getNbCells(int ADim) const;
+
+	std::size_t getNbNodes(int ADim, std::size_t ACell) const;
+
+	void getNodes(int ADim, std::size_t ACell, Lima::id_type* ANodes) const;
+
+	gmds::ECellType getType(int ADim, std::size_t ACell) const;
+
+	std::size_t getNbGroups(int ADim) const;
+
+	std::string getGroupName(int ADim, std::size_t AGroup) const;
+
+	std::size_t getGroupSize(int ADim, std::size_t AGroup) const;
+
+	void getGroupCells(int ADim, std::size_t AGroup, std::size_t AFirst,
+			std::size_t ANb, Lima::id_type* ACells) const;
+
+protected:
+
+	/* gmds ids of the nodes and cells of each dimension, by index */
+	std::vector<gmds::TCellID> ids_[4];
+
+	/* index of each gmds id, by dimension */
+	std::vector<Lima::id_type> indices_[4];
+
+	/* names and cell indices of the groups of each dimension */
+	std::vector<std::string> groupsNames_[4];
+	std::vector<std::vector<Lima::id_type> > groupsCells_[4];
+
+	/* buffer of getNodes and getNbNodes */
+	mutable std::vector<gmds::TCellID> nodesIDs_;
+
+	/* a mesh */
+	gmds::IGMesh& mesh_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_IGMESHVIEW_H_
+/*----------------------------------------------------------------------------*/
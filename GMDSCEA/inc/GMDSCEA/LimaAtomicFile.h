@@ -0,0 +1,76 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaAtomicFile.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMAATOMICFILE_H_
+#define GMDS_LIMAATOMICFILE_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+/*----------------------------------------------------------------------------*/
+#include <sys/types.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Temporary file used to write a file atomically.
+ *
+ *          The temporary file is created in the directory of the target
+ *          file, with the same suffix so that Lima detects the same format.
+ *          commit renames it to the target name, which replaces the
+ *          previous file in one step; if commit is not called (an
+ *          exception was raised while writing), the destructor removes it
+ *          and the previous file is left untouched.
+ */
+class LimaAtomicFile{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor, creates the temporary file.
+	 *
+	 *  \param AFileName the file to write.
+	 */
+	LimaAtomicFile(const std::string& AFileName);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor, removes the temporary file if it was not
+	 *          committed.
+	 */
+	virtual ~LimaAtomicFile();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Name of the temporary file, to be written.
+	 */
+	const std::string& path() const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Replace the target file by the temporary file, once its
+	 *          content is on disk. The target gets the permissions of the
+	 *          file it replaces, or the default ones (0666 minus the umask)
+	 *          for a new file.
+	 */
+	void commit();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Replace the target file by the temporary file, once its
+	 *          content is on disk, with the permissions AMode.
+	 */
+	void commit(mode_t AMode);
+
+private:
+
+	/* sync the temporary file and rename it to the target */
+	void replace();
+
+	LimaAtomicFile(const LimaAtomicFile&);
+	LimaAtomicFile& operator=(const LimaAtomicFile&);
+
+	std::string fileName_;
+	std::string path_;
+	bool committed_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMAATOMICFILE_H_
+/*----------------------------------------------------------------------------*/
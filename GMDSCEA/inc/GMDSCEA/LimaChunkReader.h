@@ -0,0 +1,128 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaChunkReader.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMACHUNKREADER_H_
+#define GMDS_LIMACHUNKREADER_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include <Lima/lima++.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  A chunk of nodes given to a LimaChunkVisitor. The arrays hold
+ *          size values and are only valid during the visit.
+ */
+struct LimaNodeChunk {
+	std::size_t size;
+	const Lima::id_type* ids;
+	const double* x;
+	const double* y;
+	const double* z;
+};
+/*----------------------------------------------------------------------------*/
+/** \brief  A chunk of cells given to a LimaChunkVisitor. The nodes of cell i
+ *          are nodes[offsets[i]] to nodes[offsets[i+1]-1] (Lima ids). For
+ *          regions, types[i] is a Lima::Polyedre::PolyedreType. When the
+ *          coordinates are resolved, x[j], y[j] and z[j] are the coordinates
+ *          of nodes[j], otherwise x, y and z are null.
+ */
+struct LimaCellChunk {
+	std::size_t size;
+	const Lima::id_type* ids;
+	const Lima::id_type* offsets;
+	const Lima::id_type* nodes;
+	const int* types;
+	const double* x;
+	const double* y;
+	const double* z;
+};
+/*----------------------------------------------------------------------------*/
+/** \brief  Callbacks of LimaChunkReader, the default ones do nothing.
+ */
+class LimaChunkVisitor {
+public:
+	virtual ~LimaChunkVisitor() {}
+
+	virtual void visitNodes(const LimaNodeChunk& /*AChunk*/) {}
+	virtual void visitEdges(const LimaCellChunk& /*AChunk*/) {}
+	virtual void visitFaces(const LimaCellChunk& /*AChunk*/) {}
+	virtual void visitRegions(const LimaCellChunk& /*AChunk*/) {}
+};
+/*----------------------------------------------------------------------------*/
+/** \brief  Sequential pass over the nodes and cells of a Lima file, given
+ *          chunk by chunk to a LimaChunkVisitor, without building a gmds
+ *          mesh.
+ *
+ *          The size of the chunks is derived from a memory budget. The file
+ *          itself is loaded by Lima::Maillage, Lima offering no partial
+ *          read, so the budget bounds the buffers of the chunks and not the
+ *          memory used by Lima.
+ */
+class LimaChunkReader{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor.
+	 *
+	 *  \param AFileName the file to visit.
+	 */
+	LimaChunkReader(const std::string& AFileName);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor.	*/
+	virtual ~LimaChunkReader();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the memory, in bytes, used by the buffers of a chunk.
+	 *          The default is 64MB.
+	 */
+	void setMemoryBudget(std::size_t ABytes);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Give the coordinates of the nodes of each cell with the cell
+	 *          chunks.
+	 */
+	void setResolveCoordinates(bool AResolve);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Number of cells of a chunk for the current budget.
+	 */
+	std::size_t getChunkSize() const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Give the nodes and the cells of the dimensions of AModel (N,
+	 *          E, F, R) to AVisitor, dimension by dimension.
+	 */
+	void visit(LimaChunkVisitor& AVisitor, gmds::MeshModel AModel);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Length unit of the file, available after visit.
+	 */
+	double getLengthUnit() const;
+
+protected:
+
+	void visitNodes(Lima::Maillage& AMesh, LimaChunkVisitor& AVisitor);
+
+	/* cells of dimension ADim (1, 2 or 3) */
+	void visitCells(Lima::Maillage& AMesh, int ADim, LimaChunkVisitor& AVisitor);
+
+	std::string fileName_;
+
+	std::size_t budget_;
+
+	bool resolveCoordinates_;
+
+	double lenghtUnit_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMACHUNKREADER_H_
+/*----------------------------------------------------------------------------*/
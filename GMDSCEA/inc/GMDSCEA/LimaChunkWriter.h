@@ -0,0 +1,278 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaChunkWriter.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMACHUNKWRITER_H_
+#define GMDS_LIMACHUNKWRITER_H_
+/*----------------------------------------------------------------------------*/
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <Lima/malipp2.h>
+#include <GMDS/IG/IG.h>
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaMetaFile.h"
+#include "GMDSCEA/MeshStatistics.h"
+#include "GMDSCEA/WriterOptions.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Chunked emission of a mli2 file, shared by the mli2 writers
+ *          (LimaWriterAPI, LimaViewWriter, LimaGatherWriter and
+ *          LimaTranscoder).
+ *
+ *          It owns the Lima writer of the current write, the chunk buffers,
+ *          the storage options (see WriterOptions) and the statistics. The
+ *          writers only traverse their entities: they give each node, cell
+ *          or group member with addNode, addCell and addGroupCell, and the
+ *          chunks are sent to Lima when full, with the coordinates rounded
+ *          to the precision asked for and the statistics updated. The
+ *          callers that fill a whole chunk at once (mesh views) use
+ *          getNodeChunk and getGroupChunk instead.
+ *
+ *          The entities of a dimension are given between beginNodes
+ *          (resp. beginCells, beginGroup) and endNodes (resp. endCells,
+ *          endGroup), inside the function given to write. Each chunk holds
+ *          getChunkSize() entities but the last one of each dimension (or
+ *          group), as the chunk checksums of LimaVerifier expect.
+ */
+class LimaChunkWriter{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor, with the default options of WriterOptions.
+	 */
+	LimaChunkWriter();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor.	*/
+	virtual ~LimaChunkWriter();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the chunk size, the compression, the coordinates
+	 *          precision and the metadata of AOptions; the numbering options
+	 *          are left to the caller. Throws a GMDSException, without
+	 *          changing the options, if they cannot be applied (see
+	 *          LimaWriterAPI::checkOptions).
+	 */
+	void setOptions(const WriterOptions& AOptions);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the number of entities sent to Lima at once, AChunkSize
+	 *          must be positive.
+	 */
+	void setChunkSize(Lima::id_type AChunkSize);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Activate or not the zlib compression of the next writes, see
+	 *          LimaWriterAPI::setCompression.
+	 */
+	void setCompression(bool ACompression);
+
+	Lima::id_type getChunkSize() const {
+		return chunkSize_;
+	}
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Statistics of the last write, computed from the chunks sent
+	 *          to Lima. The types of the faces and regions are only counted
+	 *          through addCellType.
+	 */
+	const MeshStatistics& getStatistics() const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Account for ANb cells of type AType in the statistics.
+	 */
+	void addCellType(gmds::ECellType AType, std::size_t ANb=1) {
+		stats_.addCellType(AType,ANb);
+	}
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Free the chunk buffers. They are otherwise kept from one write
+	 *          to the next.
+	 */
+	void releaseBuffers();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Write the file AFileName of dimension ADim (1 to 3): AContent
+	 *          gives the nodes, cells and groups, the attributes are then
+	 *          written. The file is written under a temporary name and
+	 *          renamed once complete (see LimaAtomicFile), so that AFileName
+	 *          is either the previous file or the new one. The Lima errors
+	 *          are printed with ACaller and raised as GMDSException.
+	 */
+	void write(const std::string& AFileName, int ADim, double ALengthUnit,
+			const std::function<void()>& AContent, const std::string& ACaller);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Once AFileName is written, write its metadata file: the
+	 *          entries of AMeta, and the statistics when the metadata are
+	 *          asked for. Without metadata nor ANeeded, the metadata file is
+	 *          removed since the one of a previous content would be wrong.
+	 */
+	void writeMetaFile(const std::string& AFileName, LimaMetaFile& AMeta,
+			bool ANeeded=false) const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Nodes: ANb nodes are given, with ids from AFirst if
+	 *          AContiguous.
+	 */
+	void beginNodes(Lima::id_type ANb, bool AContiguous, Lima::id_type AFirst);
+
+	void addNode(double AX, double AY, double AZ, Lima::id_type AID) {
+		if(count_ == capacity_) {
+			flushNodes();
+		}
+		buffers_.x[count_] = AX;
+		buffers_.y[count_] = AY;
+		buffers_.z[count_] = AZ;
+		buffers_.ids[count_] = AID;
+		count_++;
+	}
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Arrays of the next nodes of the chunk, to be filled by the
+	 *          caller. Returns the number of nodes they can hold; addNodes
+	 *          then gives the number of nodes filled.
+	 */
+	Lima::id_type getNodeChunk(double*& AX, double*& AY, double*& AZ, Lima::id_type*& AIDs);
+	void addNodes(Lima::id_type ANb) {
+		count_ += ANb;
+	}
+
+	void endNodes();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Cells of dimension ADim (1 to 3): ANb cells of at most
+	 *          AMaxNbNodes nodes are given, with ids from AFirst if
+	 *          AContiguous. The edges are counted in the statistics.
+	 */
+	void beginCells(int ADim, Lima::id_type ANb, bool AContiguous, Lima::id_type AFirst,
+			Lima::id_type AMaxNbNodes=15);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Add the cell AID of ANbNodes nodes, and of type AType for a
+	 *          region. Returns the array where the caller puts the Lima ids
+	 *          of its nodes.
+	 */
+	Lima::id_type* addCell(Lima::id_type AID, Lima::id_type ANbNodes,
+			Lima::Polyedre::PolyedreType AType=Lima::Polyedre::TETRAEDRE) {
+		if(count_ == capacity_) {
+			flushCells();
+		}
+		if(ANbNodes > maxNbNodes_) {
+			throwTooManyNodes();
+		}
+		buffers_.nbNodes[count_] = ANbNodes;
+		buffers_.types[count_] = AType;
+		buffers_.ids[count_] = AID;
+		Lima::id_type* nodes = &buffers_.connectivity[index_];
+		index_ += ANbNodes;
+		count_++;
+		return nodes;
+	}
+
+	void endCells();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Groups of dimension ADim (0 for the clouds) of names ANames
+	 *          and sizes ASizes. Their cells are then given one group after
+	 *          the other, between beginGroup and endGroup.
+	 */
+	void beginGroups(int ADim, std::vector<std::string>& ANames,
+			std::vector<Lima::id_type>& ASizes);
+
+	void beginGroup(const std::string& AName);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Add the cell AID to the current group, with its number of
+	 *          nodes for a surface, or its type for a volume.
+	 */
+	void addGroupCell(Lima::id_type AID, Lima::id_type ANbNodes=0,
+			Lima::Polyedre::PolyedreType AType=Lima::Polyedre::TETRAEDRE) {
+		if(count_ == capacity_) {
+			flushGroup();
+		}
+		buffers_.ids[count_] = AID;
+		buffers_.nbNodes[count_] = ANbNodes;
+		buffers_.types[count_] = AType;
+		count_++;
+	}
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Arrays of the next cells of the current group, see
+	 *          getNodeChunk.
+	 */
+	Lima::id_type getGroupChunk(Lima::id_type*& AIDs, Lima::id_type*& ANbNodes,
+			Lima::Polyedre::PolyedreType*& ATypes);
+	void addGroupCells(Lima::id_type ANb) {
+		count_ += ANb;
+	}
+
+	void endGroup();
+
+protected:
+
+	/* send the current chunk to writer_ */
+	void flushNodes();
+	void flushCells();
+	void flushGroup();
+
+	void throwTooManyNodes() const;
+
+	Lima::id_type chunkSize_;
+
+	/* precision of the coordinates written, and step of the quantization */
+	ECoordinatePrecision precision_;
+	double tolerance_;
+
+	/* zlib compression of the datasets */
+	bool compression_;
+
+	/* storage of the statistics (and of the chunk checksums) in the
+	 * metadata file */
+	bool metadata_;
+	bool verify_;
+
+	/* statistics of the last write */
+	MeshStatistics stats_;
+
+	/* Lima writer of the current write, released when it ends */
+	std::unique_ptr<Lima::MaliPPWriter2> writer_;
+
+	/* dimension being written, current group and maximal number of nodes
+	 * per cell */
+	int dim_;
+	std::string group_;
+	Lima::id_type maxNbNodes_;
+
+	/* size of the chunks of the current dimension, chunkSize_ or less
+	 * if it has fewer entities */
+	Lima::id_type capacity_;
+
+	/* number of entities and of connectivity values in the chunk */
+	Lima::id_type count_;
+	Lima::id_type index_;
+
+	/* chunk arrays given to writer_, grown when needed and kept between the
+	 * writes; a write uses each of them for one dimension at a time */
+	struct ChunkBuffers {
+		std::vector<double> x;
+		std::vector<double> y;
+		std::vector<double> z;
+		std::vector<Lima::id_type> ids;
+		std::vector<Lima::id_type> connectivity;
+		std::vector<Lima::id_type> nbNodes;
+		std::vector<Lima::Polyedre::PolyedreType> types;
+	};
+	ChunkBuffers buffers_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMACHUNKWRITER_H_
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,155 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaDiff.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMADIFF_H_
+#define GMDS_LIMADIFF_H_
+/*----------------------------------------------------------------------------*/
+#include <functional>
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/FlatMesh.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Kinds of differences between two meshes.
+ */
+enum EDiffCategory {
+	/* number of nodes, cells or groups */
+	GMDSCEA_DIFF_COUNT,
+	/* ids of the nodes or cells */
+	GMDSCEA_DIFF_ID,
+	/* coordinates, beyond the tolerance */
+	GMDSCEA_DIFF_COORDINATES,
+	/* nodes of the cells */
+	GMDSCEA_DIFF_CONNECTIVITY,
+	/* types of the cells */
+	GMDSCEA_DIFF_TYPE,
+	/* names and content of the groups */
+	GMDSCEA_DIFF_GROUP,
+	GMDSCEA_DIFF_NB_CATEGORIES
+};
+/*----------------------------------------------------------------------------*/
+/** \brief  A difference found by LimaDiff. index is the position of the
+ *          node, cell or group in the files (from 0) and dim its dimension
+ *          (0 for the nodes).
+ */
+struct LimaDifference {
+	EDiffCategory category;
+	int dim;
+	std::size_t index;
+	std::string message;
+};
+/*----------------------------------------------------------------------------*/
+/** \brief  Comparison of two Lima files, entity by entity in file order:
+ *          ids, coordinates within a tolerance, cell types, connectivities
+ *          (as file ids) and groups (matched by name).
+ *
+ *          Both files are read into flat arrays (see LimaFlatReader), no
+ *          gmds mesh is built. The entities are compared by chunks on
+ *          several threads and only the first differences of each category
+ *          are kept, so the memory used does not depend on the number of
+ *          differences.
+ */
+class LimaDiff{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor.	*/
+	LimaDiff();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor.	*/
+	virtual ~LimaDiff();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Absolute tolerance on the coordinates, 0 by default.
+	 */
+	void setTolerance(double ATolerance);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Number of differences kept per category, 10 by default.
+	 */
+	void setMaxDifferences(std::size_t AMax);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Number of threads, 0 (the default) means the number of
+	 *          hardware threads.
+	 */
+	void setNbThreads(int ANbThreads);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Compare the files AFileName1 and AFileName2, returns true if
+	 *          no difference was found.
+	 */
+	bool compare(const std::string& AFileName1, const std::string& AFileName2);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Compare two meshes already read.
+	 */
+	bool compare(const FlatMesh& AMesh1, const FlatMesh& AMesh2);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  First differences of each category found by the last
+	 *          comparison, ordered by category then position.
+	 */
+	const std::vector<LimaDifference>& getDifferences() const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Total number of differences of a category, including the
+	 *          ones that were not kept.
+	 */
+	std::size_t getNbDifferences(EDiffCategory ACategory) const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Name of a category.
+	 */
+	static const char* getCategoryName(EDiffCategory ACategory);
+
+	/* number of entities compared by a task */
+	static const std::size_t CHUNK_SIZE = 1<<16;
+
+protected:
+
+	/* differences found in a chunk */
+	struct Chunk {
+		std::vector<LimaDifference> differences;
+		std::size_t nbDifferences[GMDSCEA_DIFF_NB_CATEGORIES];
+	};
+
+	/* adds a difference to AChunk if there is room for it */
+	void add(Chunk& AChunk, EDiffCategory ACategory, int ADim,
+			 std::size_t AIndex, const std::string& AMessage) const;
+
+	/* adds the differences of AChunk to the ones kept */
+	void merge(const Chunk& AChunk);
+
+	/* runs ACompare on the chunks of AChunkSize entities of [0, ANb) in
+	 * parallel and merges the differences found in order, as the chunks
+	 * complete; at most twice as many chunks as threads are held */
+	void forChunks(std::size_t ANb, std::size_t AChunkSize,
+			const std::function<void(std::size_t, std::size_t, Chunk&)>& ACompare);
+
+	void compareCounts(const FlatMesh& AMesh1, const FlatMesh& AMesh2);
+	void compareNodes(const FlatMesh& AMesh1, const FlatMesh& AMesh2);
+	void compareCells(int ADim, const FlatMesh& AMesh1, const FlatMesh& AMesh2);
+	void compareGroups(int ADim, const FlatMesh& AMesh1, const FlatMesh& AMesh2);
+
+	double tolerance_;
+	std::size_t maxDifferences_;
+	int nbThreads_;
+
+	std::vector<LimaDifference> differences_[GMDSCEA_DIFF_NB_CATEGORIES];
+	std::size_t nbDifferences_[GMDSCEA_DIFF_NB_CATEGORIES];
+
+	/* all the differences kept, by category */
+	std::vector<LimaDifference> sorted_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMADIFF_H_
+/*----------------------------------------------------------------------------*/
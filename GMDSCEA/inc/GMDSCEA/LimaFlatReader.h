@@ -0,0 +1,73 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaFlatReader.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMAFLATREADER_H_
+#define GMDS_LIMAFLATREADER_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include <Lima/lima++.h>
+#include "GMDSCEA/FlatMesh.h"
+#include "GMDSCEA/LimaIDIndex.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Reader of a Lima file into a FlatMesh: no gmds mesh is built and
+ *          no gmds cell handle is used.
+ *
+ *          The arrays of the FlatMesh are resized once to their final size
+ *          and filled in place. A caller reading many files can keep the
+ *          same FlatMesh so that the arrays are reused.
+ */
+class LimaFlatReader{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor.
+	 *
+	 *  \param AMesh the arrays to fill.
+	 */
+	LimaFlatReader(FlatMesh& AMesh);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor.	*/
+	virtual ~LimaFlatReader();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Read the nodes, the cells of the dimensions of AModel (E, F,
+	 *          R) and the groups of the file AFileName. The previous content
+	 *          of the FlatMesh is discarded.
+	 */
+	void read(const std::string& AFileName, gmds::MeshModel AModel);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  gmds type of a Lima polyhedron.
+	 */
+	static gmds::ECellType getRegionType(const Lima::Polyedre::PolyedreType AType);
+
+protected:
+
+	void readNodes(Lima::Maillage& ALimaMesh);
+	void readEdges(Lima::Maillage& ALimaMesh);
+	void readFaces(Lima::Maillage& ALimaMesh);
+	void readRegions(Lima::Maillage& ALimaMesh);
+	void readGroups(Lima::Maillage& ALimaMesh, gmds::MeshModel AModel);
+
+	/* the flat mesh */
+	FlatMesh& mesh_;
+
+	/* position of the Lima ids in the arrays of mesh_ */
+	LimaIDIndex nodesIndex_;
+	/* by dimension, 1 to 3 */
+	LimaIDIndex cellsIndex_[4];
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMAFLATREADER_H_
+/*----------------------------------------------------------------------------*/
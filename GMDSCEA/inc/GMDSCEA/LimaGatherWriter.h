@@ -0,0 +1,133 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaGatherWriter.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMAGATHERWRITER_H_
+#define GMDS_LIMAGATHERWRITER_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <Lima/malipp2.h>
+#include <GMDS/IG/IG.h>
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaChunkWriter.h"
+#include "GMDSCEA/MeshStatistics.h"
+#include "GMDSCEA/WriterOptions.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Write several mesh partitions into a single mli2 file with a
+ *          global numbering, without building the merged mesh.
+ *
+ *          The partitions are streamed one after the other. Nodes shared by
+ *          several partitions (same global id) are written once, by the first
+ *          partition containing them. Groups of the same name are merged.
+ *          Nodes and cells are numbered contiguously from 1 in the file.
+ *
+ *          The chunks are emitted by LimaChunkWriter, as for LimaWriterAPI:
+ *          the file is written atomically, statistics are computed and the
+ *          storage options of WriterOptions are applied, except the
+ *          renumbering and the compaction since the numbering is already
+ *          contiguous.
+ */
+class LimaGatherWriter{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor.
+	 *
+	 *  \param AParts the partitions we want to write.
+	 */
+	LimaGatherWriter(const std::vector<gmds::IGMesh*>& AParts);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor.	*/
+	virtual ~LimaGatherWriter();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the mesh length unit. It is the conversion factor from meters
+	 */
+	void setLengthUnit(double AUnit);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Give the shared-node correspondence as a global numbering:
+	 *          AGlobalIDs[i][id] is the global id of the node of gmds id id in
+	 *          partition i. Without it, no node is shared.
+	 */
+	void setNodesGlobalIDs(const std::vector<std::vector<gmds::TCellID> >& AGlobalIDs);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the storage options (number of entities written at once,
+	 *          compression, coordinates precision, metadata), see
+	 *          WriterOptions. Throws a GMDSException, without changing the
+	 *          options, if they cannot be applied (see
+	 *          LimaWriterAPI::checkOptions).
+	 */
+	void setOptions(const WriterOptions& AOptions);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Statistics of the last write, see LimaWriterAPI::getStatistics.
+	 */
+	const MeshStatistics& getStatistics() const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Write the partitions into the file named AFileName. The
+	 *          edges, faces and regions are written if AModel has them and
+	 *          all the partitions have them. Throws a GMDSException if the
+	 *          global numbering does not cover all the nodes.
+	 */
+	void write(const std::string& AFileName, gmds::MeshModel AModel);
+
+protected:
+
+	/* compute the Lima ids of the nodes and cells of each partition */
+	void numberNodes();
+	void numberCells();
+
+	void writeNodes();
+	void writeEdges();
+	void writeFaces();
+	void writeRegions();
+
+	void writeClouds();
+	void writeLines();
+	void writeSurfaces();
+	void writeVolumes();
+
+	/* names of the groups of dimension ADim, in order of first appearance */
+	std::vector<std::string> getGroupNames(int ADim);
+
+	/* the partitions */
+	std::vector<gmds::IGMesh*> parts_;
+
+	/* global node ids, empty if not given */
+	std::vector<std::vector<gmds::TCellID> > nodesGlobalIDs_;
+
+	/* Lima ids of the nodes, edges, faces and regions: limaIDs_[dim][i][id] is
+	 * the Lima id of the cell of gmds id id in partition i */
+	std::vector<std::vector<Lima::id_type> > limaIDs_[4];
+
+	/* nodesOwned_[i][id] is true if the node is written by partition i */
+	std::vector<std::vector<bool> > nodesOwned_;
+
+	/* whether the nodes, edges, faces and regions are written: asked for
+	 * by the model given to write and held by all the partitions */
+	bool written_[4];
+
+	/* total number of nodes, edges, faces and regions */
+	Lima::id_type nbCells_[4];
+
+	/* length unit */
+	double lenghtUnit_;
+
+	/* emission of the chunks, with the storage options */
+	LimaChunkWriter chunks_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMAGATHERWRITER_H_
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,57 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaIDIndex.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMAIDINDEX_H_
+#define GMDS_LIMAIDINDEX_H_
+/*----------------------------------------------------------------------------*/
+#include <utility>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include <Lima/lima++.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Index of the Lima ids of a dimension: position of each id in the
+ *          file.
+ *
+ *          The ids are either contiguous from first, or looked up in a
+ *          table indexed by the ids when their range is small, or in a
+ *          sorted list of (id, position) pairs for sparse ids, so that ids
+ *          beyond 2^32 do not allocate a table of 2^32 entries.
+ */
+class LimaIDIndex{
+public:
+
+	LimaIDIndex();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Build the index of AIDs, the ids in the order of the file.
+	 */
+	void build(const std::vector<Lima::id_type>& AIDs);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Free the index.
+	 */
+	void clear();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Position in the file of the id AID. Throws a GMDSException
+	 *          when a sparse id is unknown.
+	 */
+	std::size_t operator()(const Lima::id_type AID) const;
+
+private:
+
+	Lima::id_type first_;
+	std::vector<std::size_t> dense_;
+	std::vector<std::pair<Lima::id_type, std::size_t> > sparse_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMAIDINDEX_H_
+/*----------------------------------------------------------------------------*/
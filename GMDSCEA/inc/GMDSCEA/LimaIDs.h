@@ -0,0 +1,53 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaIDs.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMAIDS_H_
+#define GMDS_LIMAIDS_H_
+/*----------------------------------------------------------------------------*/
+#include <limits>
+#include <sstream>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include <Lima/lima++.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Lima id (from 1) of the gmds id AID. The +1 is done on 64 bits so
+ *          that the highest gmds id does not wrap.
+ */
+inline Lima::id_type toLimaID(const gmds::TCellID AID)
+{
+	return static_cast<Lima::id_type>(AID)+1;
+}
+/*----------------------------------------------------------------------------*/
+/** \brief  gmds id of the Lima id AID (from 1). An exception is thrown when
+ *          AID is out of the range of gmds::TCellID instead of truncating it.
+ */
+inline gmds::TCellID toCellID(const Lima::id_type AID)
+{
+	if(AID == 0 ||
+	   AID-1 > static_cast<Lima::id_type>(std::numeric_limits<gmds::TCellID>::max())) {
+		std::ostringstream msg;
+		msg<<"Lima id "<<AID<<" out of the range of gmds::TCellID";
+		throw GMDSException(msg.str());
+	}
+	return static_cast<gmds::TCellID>(AID-1);
+}
+/*----------------------------------------------------------------------------*/
+/** \brief  Throws an exception when ANb entities cannot be numbered by
+ *          gmds::TCellID.
+ */
+inline void checkCellIDRange(const Lima::id_type ANb)
+{
+	if(ANb > 0) {
+		toCellID(ANb);
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMAIDS_H_
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,71 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaMemoryFile.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMAMEMORYFILE_H_
+#define GMDS_LIMAMEMORYFILE_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Temporary file kept in memory, used to write (resp. read) a Lima
+ *          file into (resp. from) a byte buffer.
+ *
+ *          Lima only opens files by name and gives no access to the HDF5
+ *          file access properties, so the HDF5 core driver cannot be used.
+ *          The file is created in a tmpfs directory (/dev/shm when it
+ *          exists): its content never goes to disk, and it is removed when
+ *          the LimaMemoryFile is destroyed.
+ */
+class LimaMemoryFile{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Create an empty file whose name ends with ASuffix, the suffix
+	 *          giving Lima the format of the file.
+	 */
+	LimaMemoryFile(const std::string& ASuffix=".mli2");
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor, the file and its metadata file, if any, are
+	 *          removed.
+	 */
+	virtual ~LimaMemoryFile();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Name of the file, to be given to Lima.
+	 */
+	const std::string& path() const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Copy the content of the file into ABuffer.
+	 */
+	void load(std::vector<char>& ABuffer) const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Replace the content of the file by the ASize bytes of AData.
+	 */
+	void store(const char* AData, std::size_t ASize);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Directory of the memory files: /dev/shm if it exists,
+	 *          $TMPDIR or /tmp otherwise.
+	 */
+	static std::string getDirectory();
+
+private:
+
+	LimaMemoryFile(const LimaMemoryFile&);
+	LimaMemoryFile& operator=(const LimaMemoryFile&);
+
+	std::string path_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMAMEMORYFILE_H_
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,146 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaMergeReader.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMAMERGEREADER_H_
+#define GMDS_LIMAMERGEREADER_H_
+/*----------------------------------------------------------------------------*/
+#include <array>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include <Lima/lima++.h>
+#include "GMDSCEA/FlatMesh.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Read a mesh stored as one file per partition into a single mesh.
+ *
+ *          The partition files are read concurrently into flat arrays (see
+ *          LimaFlatReader) that are merged, in partition order, into the
+ *          target mesh while the next ones are being read. Only the cells of
+ *          each partition are created: the nodes shared by several
+ *          partitions are created once, they are recognized through a table
+ *          from the global ids to the nodes of the mesh when the partition
+ *          index says the node ids are global, and by their coordinates (up
+ *          to a tolerance) otherwise. The edges, faces and regions shared by
+ *          several partitions (same merged nodes) are created once as well.
+ *          Groups with the same name are merged, each cell being added once.
+ *
+ *          Unless gmdscea is built with GMDSCEA_HDF5_THREADSAFE, the files
+ *          are read by forked processes that send the arrays back through a
+ *          pipe, HDF5 being then used by a single thread of each process.
+ */
+class LimaMergeReader{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor.
+	 *
+	 *  \param AMesh the mesh in which the partitions are merged, it must be
+	 *  	   empty.
+	 */
+	LimaMergeReader(gmds::IGMesh& AMesh);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor.	*/
+	virtual ~LimaMergeReader();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the maximum number of files read at the same time. 0 (the
+	 *          default) means the number of hardware threads.
+	 */
+	void setNbWorkers(int ANbWorkers);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Distance under which two nodes of different partitions are the
+	 *          same node, when the node ids are not global. With a tolerance
+	 *          <= 0 (the default), no node is merged.
+	 */
+	void setTolerance(double ATolerance);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Read the partitions described by the index AIndexFile (see
+	 *          LimaPartitionIndex).
+	 */
+	void read(const std::string& AIndexFile, gmds::MeshModel AModel);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Read the partition files AFiles, their nodes are merged by
+	 *          coordinates.
+	 */
+	void read(const std::vector<std::string>& AFiles, gmds::MeshModel AModel);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Length unit of the last partition read.
+	 */
+	double getLengthUnit() const;
+
+protected:
+
+	/* read all the files, AGlobalIDs tells whether the node ids are global */
+	void readAll(const std::vector<std::string>& AFiles, bool AGlobalIDs,
+			gmds::MeshModel AModel);
+
+	/* read the files on ANbWorkers threads, or forked processes without a
+	 * thread-safe HDF5, and merge them; the error is stored in AFailure */
+	void readWithWorkers(const std::vector<std::string>& AFiles, bool AGlobalIDs,
+			gmds::MeshModel AModel, int ANbWorkers, std::string& AFailure);
+
+	/* read one file into APart */
+	void readPartition(const std::string& AFile, gmds::MeshModel AModel,
+			FlatMesh& APart);
+
+	/* merge APart into mesh_ */
+	void merge(const FlatMesh& APart, bool AGlobalIDs);
+
+	/* node of mesh_ matching the node AIndex of APart, created if needed */
+	gmds::TCellID findOrCreateNode(const FlatMesh& APart, const std::size_t AIndex,
+			bool AGlobalIDs);
+
+	/* entry of cellsByNodes_ of the cell AIndex of ACells, of dimension ADim,
+	 * whose nodes are ANodesMap[...] in mesh_; it holds the cell of mesh_
+	 * already created with these nodes, NullID otherwise */
+	gmds::TCellID& findCell(int ADim, const FlatMesh::Cells& ACells, const std::size_t AIndex,
+			const std::vector<gmds::TCellID>& ANodesMap);
+
+	/* whether the cell AID is not yet in the group AName of dimension ADim,
+	 * it is then marked as added */
+	bool addToGroup(int ADim, const std::string& AName, gmds::TCellID AID);
+
+	/* the target mesh */
+	gmds::IGMesh& mesh_;
+
+	int nbWorkers_;
+
+	double tolerance_;
+
+	double lenghtUnit_;
+
+	/* node of mesh_ of each global id (the Lima id of the node in the
+	 * partition files) already created */
+	std::unordered_map<Lima::id_type, gmds::TCellID> globalToMesh_;
+
+	/* nodes of mesh_ stored by cell of size tolerance_ */
+	typedef std::array<long long,3> CellKey;
+	std::map<CellKey, std::vector<gmds::TCellID> > nodesGrid_;
+
+	/* edges, faces and regions of mesh_ by their sorted node ids, filled
+	 * only when nodes can be shared */
+	std::map<std::vector<gmds::TCellID>, gmds::TCellID> cellsByNodes_[4];
+	std::vector<gmds::TCellID> key_;
+
+	/* cells already added to each group of each dimension, to add the
+	 * shared cells once */
+	std::map<std::string, std::vector<bool> > groupsCells_[4];
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMAMERGEREADER_H_
+/*----------------------------------------------------------------------------*/
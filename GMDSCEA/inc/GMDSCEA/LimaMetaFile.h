@@ -0,0 +1,71 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaMetaFile.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMAMETAFILE_H_
+#define GMDS_LIMAMETAFILE_H_
+/*----------------------------------------------------------------------------*/
+#include <map>
+#include <string>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Metadata of a mesh file, stored next to it in the text file
+ *          <file>.meta as "key = value" lines.
+ *
+ *          Lima gives no way to add our own attributes to a file, so the
+ *          information computed while writing (content hash...) is kept in
+ *          this sidecar file, which external tools can read without opening
+ *          the mesh.
+ */
+class LimaMetaFile{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Name of the metadata file of AFileName.
+	 */
+	static std::string getPath(const std::string& AFileName);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Read the metadata of AFileName, returns false if there is
+	 *          none. The entries read before are removed.
+	 */
+	bool read(const std::string& AFileName);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Write the metadata of AFileName. The file is written under a
+	 *          unique temporary name then renamed (see LimaAtomicFile), so
+	 *          that a reader never sees it partially written and concurrent
+	 *          writers never mix their contents.
+	 */
+	void write(const std::string& AFileName) const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Remove the metadata of AFileName, if any.
+	 */
+	static void remove(const std::string& AFileName);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Access to the entries. get returns an empty string for a
+	 *          missing key.
+	 */
+	bool has(const std::string& AKey) const;
+	std::string get(const std::string& AKey) const;
+	void set(const std::string& AKey, const std::string& AValue);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  All the entries.
+	 */
+	const std::map<std::string,std::string>& getEntries() const;
+
+private:
+
+	std::map<std::string,std::string> entries_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMAMETAFILE_H_
+/*----------------------------------------------------------------------------*/
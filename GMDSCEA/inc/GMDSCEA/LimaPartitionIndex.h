@@ -0,0 +1,83 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaPartitionIndex.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMAPARTITIONINDEX_H_
+#define GMDS_LIMAPARTITIONINDEX_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+#include <vector>
+#include <stdint.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Small text file describing a mesh written as one file per
+ *          partition. For each partition, it gives the file name (relative to
+ *          the index), the number of nodes, edges, faces and regions, and the
+ *          global id offset of each dimension: the entity of Lima id i in a
+ *          partition has the global id offset+i-1.
+ *
+ *          When the node ids are global, the node ids stored in the partition
+ *          files are already the global ones (+1) and the nodes shared by
+ *          several partitions have the same id in each of them.
+ */
+class LimaPartitionIndex{
+public:
+
+	struct Partition {
+		/* file name, relative to the index directory */
+		std::string file;
+		/* number of nodes, edges, faces and regions */
+		uint64_t nbCells[4];
+		/* global id of the first node, edge, face and region */
+		uint64_t offsets[4];
+	};
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor of an empty index.
+	 */
+	LimaPartitionIndex();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Add a partition, its offsets follow the previous partition.
+	 */
+	void addPartition(const std::string& AFile, const uint64_t ANbCells[4]);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Indicates whether the node ids of the partition files are
+	 *          global ids.
+	 */
+	void setGlobalNodeIDs(bool AGlobal);
+	bool hasGlobalNodeIDs() const;
+
+	std::size_t getNbPartitions() const;
+	const Partition& getPartition(std::size_t AIndex) const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Path of the file of a partition, resolved against the
+	 *          directory of the index that was read or written.
+	 */
+	std::string getPartitionPath(std::size_t AIndex) const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Write (resp. read) the index into (resp. from) AFileName.
+	 */
+	void write(const std::string& AFileName);
+	void read(const std::string& AFileName);
+
+private:
+
+	/* directory of the index file */
+	std::string directory_;
+
+	bool globalNodeIDs_;
+
+	std::vector<Partition> partitions_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMAPARTITIONINDEX_H_
+/*----------------------------------------------------------------------------*/
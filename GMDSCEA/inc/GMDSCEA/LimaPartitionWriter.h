@@ -0,0 +1,88 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaPartitionWriter.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMAPARTITIONWRITER_H_
+#define GMDS_LIMAPARTITIONWRITER_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Write a set of mesh partitions, each one into its own mli2 file,
+ *          concurrently, together with a LimaPartitionIndex.
+ *
+ *          Unless gmdscea is built with GMDSCEA_HDF5_THREADSAFE, the HDF5
+ *          library is not assumed to be thread-safe and each partition is
+ *          written by a forked worker process.
+ */
+class LimaPartitionWriter{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor.
+	 *
+	 *  \param AParts the partitions we want to write.
+	 */
+	LimaPartitionWriter(const std::vector<gmds::IGMesh*>& AParts);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor.	*/
+	virtual ~LimaPartitionWriter();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the mesh length unit. It is the conversion factor from meters
+	 */
+	void setLengthUnit(double AUnit);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the maximum number of partitions written at the same time.
+	 *          0 (the default) means the number of hardware threads.
+	 */
+	void setNbWorkers(int ANbWorkers);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Give a global numbering of the nodes: AGlobalIDs[i][id] is the
+	 *          global id (from 0) of the node of gmds id id in partition i.
+	 *          Shared nodes then get the same id in every partition file.
+	 */
+	void setNodesGlobalIDs(const std::vector<std::vector<gmds::TCellID> >& AGlobalIDs);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Write partition i into getPartitionFileName(ABaseName,i) and the
+	 *          index into ABaseName.idx. The cell ids of each file are
+	 *          compacted so that the index offsets give global ids.
+	 */
+	void write(const std::string& ABaseName, gmds::MeshModel AModel);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Name of the file of partition APart.
+	 */
+	static std::string getPartitionFileName(const std::string& ABaseName, int APart);
+
+protected:
+
+	/* write one partition, called by the workers */
+	void writePartition(int APart, const std::string& AFileName, gmds::MeshModel AModel);
+
+	/* the partitions */
+	std::vector<gmds::IGMesh*> parts_;
+
+	/* global node ids, empty if not given */
+	std::vector<std::vector<gmds::TCellID> > nodesGlobalIDs_;
+
+	/* length unit */
+	double lenghtUnit_;
+
+	int nbWorkers_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMAPARTITIONWRITER_H_
+/*----------------------------------------------------------------------------*/
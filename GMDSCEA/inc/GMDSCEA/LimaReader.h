@@ -11,6 +11,7 @@
 #include <iostream>
 #include <fstream>
 #include <map>
+#include <sstream>
 #include "Lima/lima++.h"
 /*----------------------------------------------------------------------------*/
 // headers of VTK files
@@ -18,13 +19,63 @@
 #include <GMDS/IG/IGMesh.h>
 #include <GMDS/IO/IReader.h>
 /*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaIDIndex.h"
+#include "GMDSCEA/LimaIDs.h"
+#include "GMDSCEA/LimaMemoryFile.h"
+#include "GMDSCEA/LimaMetaFile.h"
+#include "GMDSCEA/SpaceFillingCurve.h"
+/*----------------------------------------------------------------------------*/
 namespace gmds{
 /*----------------------------------------------------------------------------*/
+/* Creation of a face (resp. region) from its TNbNodes nodes. Used by the
+ * LimaReader kernels specialized for single-cell-type meshes. */
+template<int TNbNodes> struct LimaFaceBuilder;
+template<int TNbNodes> struct LimaRegionBuilder;
+
+template<> struct LimaFaceBuilder<3> {
+	template<typename TMesh>
+	static Face build(TMesh& AMesh, const Node* AN) {
+		return AMesh.newTriangle(AN[0],AN[1],AN[2]);
+	}
+};
+template<> struct LimaFaceBuilder<4> {
+	template<typename TMesh>
+	static Face build(TMesh& AMesh, const Node* AN) {
+		return AMesh.newQuad(AN[0],AN[1],AN[2],AN[3]);
+	}
+};
+template<> struct LimaRegionBuilder<4> {
+	template<typename TMesh>
+	static Region build(TMesh& AMesh, const Node* AN) {
+		return AMesh.newTet(AN[0],AN[1],AN[2],AN[3]);
+	}
+};
+template<> struct LimaRegionBuilder<5> {
+	template<typename TMesh>
+	static Region build(TMesh& AMesh, const Node* AN) {
+		return AMesh.newPyramid(AN[0],AN[1],AN[2],AN[3],AN[4]);
+	}
+};
+template<> struct LimaRegionBuilder<6> {
+	template<typename TMesh>
+	static Region build(TMesh& AMesh, const Node* AN) {
+		return AMesh.newPrism3(AN[0],AN[1],AN[2],AN[3],AN[4],AN[5]);
+	}
+};
+template<> struct LimaRegionBuilder<8> {
+	template<typename TMesh>
+	static Region build(TMesh& AMesh, const Node* AN) {
+		return AMesh.newHex(AN[0],AN[1],AN[2],AN[3],AN[4],AN[5],AN[6],AN[7]);
+	}
+};
+/*----------------------------------------------------------------------------*/
 #include "LimaReader_def.h"
 /*----------------------------------------------------------------------------*/
 template<typename TMesh>
 LimaReader<TMesh>::LimaReader(TMesh& AMesh)
-:IReader<TMesh>(AMesh), lenghtUnit_(1.)
+:IReader<TMesh>(AMesh), lenghtUnit_(1.),
+ renumbering_(GMDSCEA_RENUMBER_NONE), curve_(GMDSCEA_RENUMBER_NONE),
+ preserve_ids_(false)
 {}
 
 /*----------------------------------------------------------------------------*/
@@ -39,6 +90,19 @@ double LimaReader<TMesh>::getLengthUnit()
 }
 /*----------------------------------------------------------------------------*/
 template<typename TMesh>
+void LimaReader<TMesh>::setRenumbering(ERenumbering ARenumbering)
+{
+	renumbering_ = ARenumbering;
+	curve_ = SpaceFillingCurve(ARenumbering);
+}
+/*----------------------------------------------------------------------------*/
+template<typename TMesh>
+void LimaReader<TMesh>::setPreserveIDs(bool APreserve)
+{
+	preserve_ids_ = APreserve;
+}
+/*----------------------------------------------------------------------------*/
+template<typename TMesh>
 void LimaReader<TMesh>::read(const std::string& AFileName, gmds::MeshModel AModel)
 {
 	Lima::Maillage m;
@@ -50,6 +114,30 @@ void LimaReader<TMesh>::read(const std::string& AFileName, gmds::MeshModel AMode
 		throw GMDSException("Lima cannot read the file "+AFileName);
 	}
 	lenghtUnit_ = m.unite_longueur();
+
+	if(preserve_ids_)
+	{
+		if(renumbering_!=GMDSCEA_RENUMBER_NONE)
+			throw GMDSException("LimaReader::read ids cannot be both preserved and renumbered");
+		if(this->mesh_.getNbNodes()!=0 || this->mesh_.getNbEdges()!=0 ||
+		   this->mesh_.getNbFaces()!=0 || this->mesh_.getNbRegions()!=0)
+			throw GMDSException("LimaReader::read ids can only be preserved in an empty mesh");
+	}
+
+	// id capacity of each dimension, to restore the holes after the last id
+	const char* capacity_keys[4] = {"ids.nodes", "ids.edges", "ids.faces", "ids.regions"};
+	LimaMetaFile meta;
+	const bool has_meta = preserve_ids_ && meta.read(AFileName);
+	for(int d=0; d<4; d++)
+	{
+		id_capacities_[d] = 0;
+		if(has_meta && meta.has(capacity_keys[d]))
+		{
+			std::istringstream value(meta.get(capacity_keys[d]));
+			value>>id_capacities_[d];
+		}
+	}
+
 	readNodes(m);
 	if (this->mesh_.getModel().has(E) && AModel.has(E))
 		readEdges(m);
@@ -62,33 +150,89 @@ void LimaReader<TMesh>::read(const std::string& AFileName, gmds::MeshModel AMode
 }
 /*----------------------------------------------------------------------------*/
 template<typename TMesh>
+void LimaReader<TMesh>::readFromBuffer(const char* AData, std::size_t ASize, gmds::MeshModel AModel)
+{
+	LimaMemoryFile file(".mli2");
+	file.store(AData,ASize);
+	read(file.path(),AModel);
+}
+/*----------------------------------------------------------------------------*/
+template<typename TMesh>
 void LimaReader<TMesh>::readNodes(Lima::Maillage& ALimaMesh)
 {
-	/** look for the highest node id*/
-	size_t max_id=0;
-	for(unsigned int i = 0; i<ALimaMesh.nb_noeuds(); i++)
-		if(ALimaMesh.noeud(i).id()>max_id)
-			max_id=ALimaMesh.noeud(i).id();
+	/** node ids in the file order, and the highest one*/
+	std::vector<Lima::id_type> node_ids(ALimaMesh.nb_noeuds());
+	Lima::id_type max_id=0;
+	for(Lima::size_type i = 0; i<ALimaMesh.nb_noeuds(); i++)
+	{
+		node_ids[i]=ALimaMesh.noeud(i).id();
+		if(node_ids[i]>max_id)
+			max_id=node_ids[i];
+	}
 
-	nodes_connection_.resize(max_id);
+	/* in restart mode the gmds ids go up to max_id-1 */
+	checkCellIDRange(preserve_ids_?max_id:ALimaMesh.nb_noeuds());
+	/* the nodes are stored by position in the file, not by id, so that
+	 * ids beyond 2^32 do not allocate a table of max_id nodes */
+	nodes_index_.build(node_ids);
+	nodes_connection_.resize(ALimaMesh.nb_noeuds());
 
-	for(unsigned int i = 0; i < ALimaMesh.nb_noeuds(); i++)
+	cells_order_.clear();
+	if(renumbering_!=GMDSCEA_RENUMBER_NONE)
 	{
-	      Lima::Noeud ni = ALimaMesh.noeud(i);
+		curve_ = SpaceFillingCurve(renumbering_);
+		for(Lima::size_type i = 0; i < ALimaMesh.nb_noeuds(); i++)
+		{
+			Lima::Noeud ni = ALimaMesh.noeud(i);
+			curve_.addToBoundingBox(ni.x(),ni.y(),ni.z());
+		}
+		std::vector<uint64_t> keys(ALimaMesh.nb_noeuds());
+		for(Lima::size_type i = 0; i < ALimaMesh.nb_noeuds(); i++)
+		{
+			Lima::Noeud ni = ALimaMesh.noeud(i);
+			keys[i] = curve_.key(ni.x(),ni.y(),ni.z());
+		}
+		SpaceFillingCurve::sort(keys,cells_order_);
+	}
+	else if(preserve_ids_)
+	{
+		std::vector<uint64_t> ids(node_ids.begin(),node_ids.end());
+		sortByID(ids);
+	}
+
+	for(Lima::size_type i = 0; i < ALimaMesh.nb_noeuds(); i++)
+	{
+	      const std::size_t index = cellIndex(i);
+	      Lima::Noeud ni = ALimaMesh.noeud(index);
+	      if(preserve_ids_)
+	    	  fillNodeHoles(ni.id());
 	      Node n = this->mesh_.newNode(ni.x(),ni.y(),ni.z());
-	      nodes_connection_[ni.id()-1] = n;
+	      nodes_connection_[index] = n;
 	}
 
-	for(unsigned int index=0;index<ALimaMesh.nb_nuages();index++)
+	if(preserve_ids_)
+		fillNodeHoles(id_capacities_[0]+1);
+	for(Lima::size_type i = 0; i < node_holes_.size(); i++)
+		this->mesh_.deleteNode(node_holes_[i]);
+	node_holes_.clear();
+
+	if(renumbering_!=GMDSCEA_RENUMBER_NONE)
+	{
+		Variable<Lima::id_type>* lima_ids = getLimaIDVariable(GMDS_NODE);
+		for(Lima::size_type i = 0; i < ALimaMesh.nb_noeuds(); i++)
+			(*lima_ids)[nodes_connection_[i].getID()] = node_ids[i];
+	}
+
+	for(Lima::size_type index=0;index<ALimaMesh.nb_nuages();index++)
 	{
 		Lima::Nuage lima_nuage = ALimaMesh.nuage(index);
-		int nbNodesInCloud = lima_nuage.nb_noeuds();
+		Lima::size_type nbNodesInCloud = lima_nuage.nb_noeuds();
 
 		typename TMesh::cloud& cl = this->mesh_.newCloud(lima_nuage.nom());
 
-		for(unsigned int node_index = 0; node_index<nbNodesInCloud;node_index++)
+		for(Lima::size_type node_index = 0; node_index<nbNodesInCloud;node_index++)
 		{
-			cl.add(nodes_connection_[lima_nuage.noeud(node_index).id()-1]);
+			cl.add(getNode(lima_nuage.noeud(node_index).id()));
 		}
 	}
 
@@ -97,33 +241,72 @@ void LimaReader<TMesh>::readNodes(Lima::Maillage& ALimaMesh)
 template<typename TMesh>
 void LimaReader<TMesh>::readEdges(Lima::Maillage& ALimaMesh)
 {
-	int max_id=0;
-	for(unsigned int i = 0; i < ALimaMesh.nb_bras(); i++)
+	std::vector<Lima::id_type> edge_ids(ALimaMesh.nb_bras());
+	Lima::id_type max_id=0;
+	for(Lima::size_type i = 0; i < ALimaMesh.nb_bras(); i++)
 	{
-		if(ALimaMesh.bras(i).id()>max_id)
-				max_id=ALimaMesh.bras(i).id();
+		edge_ids[i]=ALimaMesh.bras(i).id();
+		if(edge_ids[i]>max_id)
+				max_id=edge_ids[i];
 	}
 
+	/* edges by position in the file */
 	std::vector<Edge> edges_connection;
-	edges_connection.resize(max_id);
-	for(unsigned int i = 0; i < ALimaMesh.nb_bras(); i++)
+	/* in restart mode the gmds ids go up to max_id-1 */
+	checkCellIDRange(preserve_ids_?max_id:ALimaMesh.nb_bras());
+	edges_connection.resize(ALimaMesh.nb_bras());
+
+	cells_order_.clear();
+	if(renumbering_!=GMDSCEA_RENUMBER_NONE)
+	{
+		std::vector<uint64_t> keys(ALimaMesh.nb_bras());
+		for(Lima::size_type i = 0; i < ALimaMesh.nb_bras(); i++)
+			keys[i] = getCentroidKey(ALimaMesh.bras(i));
+		SpaceFillingCurve::sort(keys,cells_order_);
+	}
+	else if(preserve_ids_)
+	{
+		std::vector<uint64_t> ids(edge_ids.begin(),edge_ids.end());
+		sortByID(ids);
+	}
+
+	for(Lima::size_type i = 0; i < ALimaMesh.nb_bras(); i++)
+	{
+		const std::size_t index = cellIndex(i);
+		Lima::Bras  b = ALimaMesh.bras(index);
+		if(preserve_ids_)
+			fillEdgeHoles(b.id(),getNode(b.noeud(0).id()));
+		Edge e = this->mesh_.newEdge(getNode(b.noeud(0).id()),
+								getNode(b.noeud(1).id()));
+		edges_connection[index]=e;
+	}
+
+	if(preserve_ids_ && !nodes_connection_.empty())
+		fillEdgeHoles(id_capacities_[1]+1,nodes_connection_[0]);
+	for(Lima::size_type i = 0; i < edge_holes_.size(); i++)
+		this->mesh_.deleteEdge(edge_holes_[i]);
+	edge_holes_.clear();
+
+	if(renumbering_!=GMDSCEA_RENUMBER_NONE)
 	{
-		Lima::Bras  b = ALimaMesh.bras(i);
-		Edge e = this->mesh_.newEdge(nodes_connection_[b.noeud(0).id()-1],
-								nodes_connection_[b.noeud(1).id()-1]);
-		edges_connection[b.id()-1]=e;
+		Variable<Lima::id_type>* lima_ids = getLimaIDVariable(GMDS_EDGE);
+		for(Lima::size_type i = 0; i < ALimaMesh.nb_bras(); i++)
+			(*lima_ids)[edges_connection[i].getID()] = edge_ids[i];
 	}
 
-	for(unsigned int index=0;index<ALimaMesh.nb_lignes();index++)
+	LimaIDIndex edges_index;
+	edges_index.build(edge_ids);
+
+	for(Lima::size_type index=0;index<ALimaMesh.nb_lignes();index++)
 	{
 		Lima::Ligne lima_ligne = ALimaMesh.ligne(index);
-		int nbEdgesInLine= lima_ligne.nb_bras();
+		Lima::size_type nbEdgesInLine= lima_ligne.nb_bras();
 
 		typename TMesh::line& li = this->mesh_.newLine(lima_ligne.nom());
 
-		for(unsigned int edge_index = 0; edge_index<nbEdgesInLine;edge_index++)
+		for(Lima::size_type edge_index = 0; edge_index<nbEdgesInLine;edge_index++)
 		{
-			li.add(edges_connection[lima_ligne.bras(edge_index).id()-1]);
+			li.add(edges_connection[edges_index(lima_ligne.bras(edge_index).id())]);
 		}
 	}
 
@@ -134,74 +317,104 @@ template<typename TMesh>
 void LimaReader<TMesh>::readFaces(Lima::Maillage& ALimaMesh)
 {
 
-	int max_id=0;
-	for(unsigned int i = 0; i < ALimaMesh.nb_polygones(); i++)
+	std::vector<Lima::id_type> face_ids(ALimaMesh.nb_polygones());
+	Lima::id_type max_id=0;
+	// number of nodes shared by all the polygons, 0 if they differ
+	Lima::size_type nb_nodes = (ALimaMesh.nb_polygones()>0)?ALimaMesh.polygone(0).nb_noeuds():0;
+	for(Lima::size_type i = 0; i < ALimaMesh.nb_polygones(); i++)
 	{
-		if(ALimaMesh.polygone(i).id()>max_id)
-				max_id=ALimaMesh.polygone(i).id();
+		Lima::Polygone p = ALimaMesh.polygone(i);
+		face_ids[i]=p.id();
+		if(p.id()>max_id)
+				max_id=p.id();
+		if(p.nb_noeuds()!=nb_nodes)
+				nb_nodes=0;
 	}
 
+	/* faces by position in the file */
 	std::vector<Face> faces_connection;
-	faces_connection.resize(max_id);
+	/* in restart mode the gmds ids go up to max_id-1 */
+	checkCellIDRange(preserve_ids_?max_id:ALimaMesh.nb_polygones());
+	faces_connection.resize(ALimaMesh.nb_polygones());
+
+	cells_order_.clear();
+	if(renumbering_!=GMDSCEA_RENUMBER_NONE)
+	{
+		std::vector<uint64_t> keys(ALimaMesh.nb_polygones());
+		for(Lima::size_type i = 0; i < ALimaMesh.nb_polygones(); i++)
+			keys[i] = getCentroidKey(ALimaMesh.polygone(i));
+		SpaceFillingCurve::sort(keys,cells_order_);
+	}
+	else if(preserve_ids_)
+	{
+		std::vector<uint64_t> ids(face_ids.begin(),face_ids.end());
+		sortByID(ids);
+	}
+
+	if(nb_nodes==3)
+		readFacesFixed<3>(ALimaMesh,faces_connection);
+	else if(nb_nodes==4)
+		readFacesFixed<4>(ALimaMesh,faces_connection);
+	else {
+		const unsigned int LimaReader_MAX_NBNODES_PER_FACE = 15; //Lima::MAX_NOEUDS;
+
+		// nodes of the current polygon; the storage is reserved once and
+		// reused from one face to the next, so no allocation is done per face.
+		std::vector<Node> nodes;
+		nodes.reserve(LimaReader_MAX_NBNODES_PER_FACE);
+
+		for(Lima::size_type i = 0; i < ALimaMesh.nb_polygones(); i++)
+		{
+			const std::size_t index = cellIndex(i);
+			Lima::Polygone  p = ALimaMesh.polygone(index);
+			if(preserve_ids_)
+				fillFaceHoles(p.id(),getNode(p.noeud(0).id()));
+			const unsigned int nb_face_nodes = p.nb_noeuds();
+
+			if(nb_face_nodes<3 || nb_face_nodes>LimaReader_MAX_NBNODES_PER_FACE)
+				throw GMDSException("LimaReader::readFaces a polygon has less than 3 or more than 15 (Lima::MAX_NOEUDS) nodes.");
+
+			nodes.clear();
+			for(Lima::size_type k = 0; k < nb_face_nodes; k++)
+				nodes.push_back(getNode(p.noeud(k).id()));
+
+			Face f;
+			if(nb_face_nodes==3)
+				f=this->mesh_.newTriangle(nodes[0],nodes[1],nodes[2]);
+			else if(nb_face_nodes==4)
+				f=this->mesh_.newQuad(nodes[0],nodes[1],nodes[2],nodes[3]);
+			else
+				f=this->mesh_.newPolygon(nodes);
+
+			faces_connection[index]=f;
+		}
+	}
+
+	if(preserve_ids_ && !nodes_connection_.empty())
+		fillFaceHoles(id_capacities_[2]+1,nodes_connection_[0]);
+	for(Lima::size_type i = 0; i < face_holes_.size(); i++)
+		this->mesh_.deleteFace(face_holes_[i]);
+	face_holes_.clear();
 
-	for(unsigned int i = 0; i < ALimaMesh.nb_polygones(); i++)
+	if(renumbering_!=GMDSCEA_RENUMBER_NONE)
 	{
-		Lima::Polygone  p = ALimaMesh.polygone(i);
-		Face f;
-		switch(p.nb_noeuds()){
-		case 3:
-	        {
-	        	f=this->mesh_.newTriangle(nodes_connection_[p.noeud(0).id()-1],
-									nodes_connection_[p.noeud(1).id()-1],
-									nodes_connection_[p.noeud(2).id()-1]);
-	        }
-	        break;
-	      case 4:
-	        {
-	        	f=this->mesh_.newQuad(nodes_connection_[p.noeud(0).id()-1],
-								nodes_connection_[p.noeud(1).id()-1],
-								nodes_connection_[p.noeud(2).id()-1],
-								nodes_connection_[p.noeud(3).id()-1]);
-	        }
-	        break;
-	      case 5:
-	        {
-	        	std::vector<Node> nodes;
-	        	nodes.resize(5);
-	        	nodes[0] = nodes_connection_[p.noeud(0).id()-1];
-	        	nodes[1] = nodes_connection_[p.noeud(1).id()-1];
-	        	nodes[2] = nodes_connection_[p.noeud(2).id()-1];
-	        	nodes[3] = nodes_connection_[p.noeud(3).id()-1];
-	        	nodes[4] = nodes_connection_[p.noeud(4).id()-1];
-	        	f=this->mesh_.newPolygon(nodes);
-	        }
-	        break;
-	      case 6:
-	        {
-	        	std::vector<Node> nodes;
-	        	nodes.resize(6);
-	        	nodes[0] = nodes_connection_[p.noeud(0).id()-1];
-	        	nodes[1] = nodes_connection_[p.noeud(1).id()-1];
-	        	nodes[2] = nodes_connection_[p.noeud(2).id()-1];
-	        	nodes[3] = nodes_connection_[p.noeud(3).id()-1];
-	        	nodes[4] = nodes_connection_[p.noeud(4).id()-1];
-	        	nodes[5] = nodes_connection_[p.noeud(5).id()-1];
-	        	f=this->mesh_.newPolygon(nodes);
-	        }
-	        break;
-	      }
-		faces_connection[p.id()-1]=f;
-	}
-
-	for(unsigned int index=0;index<ALimaMesh.nb_surfaces();index++)
+		Variable<Lima::id_type>* lima_ids = getLimaIDVariable(GMDS_FACE);
+		for(Lima::size_type i = 0; i < ALimaMesh.nb_polygones(); i++)
+			(*lima_ids)[faces_connection[i].getID()] = face_ids[i];
+	}
+
+	LimaIDIndex faces_index;
+	faces_index.build(face_ids);
+
+	for(Lima::size_type index=0;index<ALimaMesh.nb_surfaces();index++)
 	{
 		Lima::Surface lima_surf = ALimaMesh.surface(index);
-		int nbFacesInSurf= lima_surf.nb_polygones();
+		Lima::size_type nbFacesInSurf= lima_surf.nb_polygones();
 
 		typename IGMesh::surface& su = this->mesh_.newSurface(lima_surf.nom());
-		for(unsigned int face_index = 0; face_index<nbFacesInSurf;face_index++)
+		for(Lima::size_type face_index = 0; face_index<nbFacesInSurf;face_index++)
 		{
-			su.add(faces_connection[lima_surf.polygone(face_index).id()-1]);
+			su.add(faces_connection[faces_index(lima_surf.polygone(face_index).id())]);
 		}
 	}
 
@@ -211,111 +424,271 @@ template<typename TMesh>
 void LimaReader<TMesh>::readRegions(Lima::Maillage& ALimaMesh)
 {
 
-	int max_id=0;
-	for(unsigned int i = 0; i < ALimaMesh.nb_polyedres(); i++)
+	std::vector<Lima::id_type> region_ids(ALimaMesh.nb_polyedres());
+	Lima::id_type max_id=0;
+	// number of nodes shared by all the polyhedra, 0 if they differ
+	Lima::size_type nb_nodes = (ALimaMesh.nb_polyedres()>0)?ALimaMesh.polyedre(0).nb_noeuds():0;
+	for(Lima::size_type i = 0; i < ALimaMesh.nb_polyedres(); i++)
 	{
-		if(ALimaMesh.polyedre(i).id()>max_id)
-				max_id=ALimaMesh.polyedre(i).id();
+		Lima::Polyedre p = ALimaMesh.polyedre(i);
+		region_ids[i]=p.id();
+		if(p.id()>max_id)
+				max_id=p.id();
+		if(p.nb_noeuds()!=nb_nodes)
+				nb_nodes=0;
 	}
 
+	/* regions by position in the file */
 	std::vector<Region> regions_connection;
-	regions_connection.resize(max_id);
+	/* in restart mode the gmds ids go up to max_id-1 */
+	checkCellIDRange(preserve_ids_?max_id:ALimaMesh.nb_polyedres());
+	regions_connection.resize(ALimaMesh.nb_polyedres());
 
-	for(unsigned int i = 0; i < ALimaMesh.nb_polyedres(); ++i)
+	cells_order_.clear();
+	if(renumbering_!=GMDSCEA_RENUMBER_NONE)
+	{
+		std::vector<uint64_t> keys(ALimaMesh.nb_polyedres());
+		for(Lima::size_type i = 0; i < ALimaMesh.nb_polyedres(); i++)
+			keys[i] = getCentroidKey(ALimaMesh.polyedre(i));
+		SpaceFillingCurve::sort(keys,cells_order_);
+	}
+	else if(preserve_ids_)
 	{
-		Lima::Polyedre  p = ALimaMesh.polyedre(i);
-		Region  r;
-		switch(p.nb_noeuds()){
-		case 4:
-			{
-				r=this->mesh_.newTet(nodes_connection_[p.noeud(0).id()-1],
-							   nodes_connection_[p.noeud(1).id()-1],
-							   nodes_connection_[p.noeud(2).id()-1],
-							   nodes_connection_[p.noeud(3).id()-1]);
-			}
-			break;
-		  case 5:
-			{
-				r=this->mesh_.newPyramid(nodes_connection_[p.noeud(0).id()-1],
-								   nodes_connection_[p.noeud(1).id()-1],
-							       nodes_connection_[p.noeud(2).id()-1],
-							       nodes_connection_[p.noeud(3).id()-1],
-							       nodes_connection_[p.noeud(4).id()-1]);
-			}
-			break;
-		  case 6:
-			{
-				r=this->mesh_.newPrism3(nodes_connection_[p.noeud(0).id()-1],
-							      nodes_connection_[p.noeud(1).id()-1],
-							      nodes_connection_[p.noeud(2).id()-1],
-							      nodes_connection_[p.noeud(3).id()-1],
-							      nodes_connection_[p.noeud(4).id()-1],
-								  nodes_connection_[p.noeud(5).id()-1]);
-			}
-			break;
-		  case 8:
-			{
-				r=this->mesh_.newHex(nodes_connection_[p.noeud(0).id()-1],
-							   nodes_connection_[p.noeud(1).id()-1],
-							   nodes_connection_[p.noeud(2).id()-1],
-							   nodes_connection_[p.noeud(3).id()-1],
-							   nodes_connection_[p.noeud(4).id()-1],
-							   nodes_connection_[p.noeud(5).id()-1],
-							   nodes_connection_[p.noeud(6).id()-1],
-							   nodes_connection_[p.noeud(7).id()-1]);
-			}
-			break;
-		  case 10:
-			{
-				throw GMDSException("Prism5 type not yet implemented");
-//				r=this->mesh_.newPrism5(nodes_connection_[p.noeud(0).id()-1],
-//							      nodes_connection_[p.noeud(1).id()-1],
-//							      nodes_connection_[p.noeud(2).id()-1],
-//							      nodes_connection_[p.noeud(3).id()-1],
-//							      nodes_connection_[p.noeud(4).id()-1],
-//							      nodes_connection_[p.noeud(5).id()-1],
-//							      nodes_connection_[p.noeud(6).id()-1],
-//							      nodes_connection_[p.noeud(7).id()-1],
-//							      nodes_connection_[p.noeud(8).id()-1],
-//								  nodes_connection_[p.noeud(9).id()-1]);
-			}
-			break;
-		  case 12:
-			{
-				throw GMDSException("Prism6 type not yet implemented");
-//				r=this->mesh_.newPrism6(nodes_connection_[p.noeud(0).id()-1],
-//							      nodes_connection_[p.noeud(1).id()-1],
-//							      nodes_connection_[p.noeud(2).id()-1],
-//							      nodes_connection_[p.noeud(3).id()-1],
-//							      nodes_connection_[p.noeud(4).id()-1],
-//							      nodes_connection_[p.noeud(5).id()-1],
-//							      nodes_connection_[p.noeud(6).id()-1],
-//							      nodes_connection_[p.noeud(7).id()-1],
-//							      nodes_connection_[p.noeud(8).id()-1],
-//							      nodes_connection_[p.noeud(9).id()-1],
-//							      nodes_connection_[p.noeud(10).id()-1],
-//								  nodes_connection_[p.noeud(11).id()-1]);
-			}
-			break;
-		  }
-		regions_connection[p.id()-1]=r;
-	}
-
-	for(unsigned int index=0;index<ALimaMesh.nb_volumes();index++)
+		std::vector<uint64_t> ids(region_ids.begin(),region_ids.end());
+		sortByID(ids);
+	}
+
+	if(nb_nodes==4)
+		readRegionsFixed<4>(ALimaMesh,regions_connection);
+	else if(nb_nodes==5)
+		readRegionsFixed<5>(ALimaMesh,regions_connection);
+	else if(nb_nodes==6)
+		readRegionsFixed<6>(ALimaMesh,regions_connection);
+	else if(nb_nodes==8)
+		readRegionsFixed<8>(ALimaMesh,regions_connection);
+	else {
+		for(Lima::size_type i = 0; i < ALimaMesh.nb_polyedres(); ++i)
+		{
+			const std::size_t index = cellIndex(i);
+			Lima::Polyedre  p = ALimaMesh.polyedre(index);
+			if(preserve_ids_)
+				fillRegionHoles(p.id(),getNode(p.noeud(0).id()));
+			Region  r;
+			switch(p.nb_noeuds()){
+			case 4:
+				{
+					r=this->mesh_.newTet(getNode(p.noeud(0).id()),
+								   getNode(p.noeud(1).id()),
+								   getNode(p.noeud(2).id()),
+								   getNode(p.noeud(3).id()));
+				}
+				break;
+			  case 5:
+				{
+					r=this->mesh_.newPyramid(getNode(p.noeud(0).id()),
+									   getNode(p.noeud(1).id()),
+								       getNode(p.noeud(2).id()),
+								       getNode(p.noeud(3).id()),
+								       getNode(p.noeud(4).id()));
+				}
+				break;
+			  case 6:
+				{
+					r=this->mesh_.newPrism3(getNode(p.noeud(0).id()),
+								      getNode(p.noeud(1).id()),
+								      getNode(p.noeud(2).id()),
+								      getNode(p.noeud(3).id()),
+								      getNode(p.noeud(4).id()),
+									  getNode(p.noeud(5).id()));
+				}
+				break;
+			  case 8:
+				{
+					r=this->mesh_.newHex(getNode(p.noeud(0).id()),
+								   getNode(p.noeud(1).id()),
+								   getNode(p.noeud(2).id()),
+								   getNode(p.noeud(3).id()),
+								   getNode(p.noeud(4).id()),
+								   getNode(p.noeud(5).id()),
+								   getNode(p.noeud(6).id()),
+								   getNode(p.noeud(7).id()));
+				}
+				break;
+			  case 10:
+				{
+					throw GMDSException("Prism5 type not yet implemented");
+	//				r=this->mesh_.newPrism5(getNode(p.noeud(0).id()),
+	//							      getNode(p.noeud(1).id()),
+	//							      getNode(p.noeud(2).id()),
+	//							      getNode(p.noeud(3).id()),
+	//							      getNode(p.noeud(4).id()),
+	//							      getNode(p.noeud(5).id()),
+	//							      getNode(p.noeud(6).id()),
+	//							      getNode(p.noeud(7).id()),
+	//							      getNode(p.noeud(8).id()),
+	//								  getNode(p.noeud(9).id()));
+				}
+				break;
+			  case 12:
+				{
+					throw GMDSException("Prism6 type not yet implemented");
+	//				r=this->mesh_.newPrism6(getNode(p.noeud(0).id()),
+	//							      getNode(p.noeud(1).id()),
+	//							      getNode(p.noeud(2).id()),
+	//							      getNode(p.noeud(3).id()),
+	//							      getNode(p.noeud(4).id()),
+	//							      getNode(p.noeud(5).id()),
+	//							      getNode(p.noeud(6).id()),
+	//							      getNode(p.noeud(7).id()),
+	//							      getNode(p.noeud(8).id()),
+	//							      getNode(p.noeud(9).id()),
+	//							      getNode(p.noeud(10).id()),
+	//								  getNode(p.noeud(11).id()));
+				}
+				break;
+			  }
+			regions_connection[index]=r;
+		}
+	}
+
+	if(preserve_ids_ && !nodes_connection_.empty())
+		fillRegionHoles(id_capacities_[3]+1,nodes_connection_[0]);
+	for(Lima::size_type i = 0; i < region_holes_.size(); i++)
+		this->mesh_.deleteRegion(region_holes_[i]);
+	region_holes_.clear();
+
+	if(renumbering_!=GMDSCEA_RENUMBER_NONE)
+	{
+		Variable<Lima::id_type>* lima_ids = getLimaIDVariable(GMDS_REGION);
+		for(Lima::size_type i = 0; i < ALimaMesh.nb_polyedres(); i++)
+			(*lima_ids)[regions_connection[i].getID()] = region_ids[i];
+	}
+
+	LimaIDIndex regions_index;
+	regions_index.build(region_ids);
+
+	for(Lima::size_type index=0;index<ALimaMesh.nb_volumes();index++)
 	{
 		Lima::Volume lima_vol = ALimaMesh.volume(index);
-		int nbRegionsInVol= lima_vol.nb_polyedres();
+		Lima::size_type nbRegionsInVol= lima_vol.nb_polyedres();
 
 		typename TMesh::volume& vo = this->mesh_.newVolume(lima_vol.nom());
 
-		for(unsigned int r_index = 0; r_index<nbRegionsInVol;r_index++)
+		for(Lima::size_type r_index = 0; r_index<nbRegionsInVol;r_index++)
 		{
-			vo.add(regions_connection[lima_vol.polyedre(r_index).id()-1]);
+			vo.add(regions_connection[regions_index(lima_vol.polyedre(r_index).id())]);
 		}
 	}
 
 }
 /*----------------------------------------------------------------------------*/
+template<typename TMesh>
+template<int TNbNodes>
+void LimaReader<TMesh>::readFacesFixed(Lima::Maillage& ALimaMesh,
+									   std::vector<Face>& AFaces)
+{
+	Node nodes[TNbNodes];
+	for(Lima::size_type i = 0; i < ALimaMesh.nb_polygones(); i++)
+	{
+		const std::size_t index = cellIndex(i);
+		Lima::Polygone  p = ALimaMesh.polygone(index);
+		if(preserve_ids_)
+			fillFaceHoles(p.id(),getNode(p.noeud(0).id()));
+		for(int k = 0; k < TNbNodes; k++)
+			nodes[k] = getNode(p.noeud(k).id());
+
+		AFaces[index] = LimaFaceBuilder<TNbNodes>::build(this->mesh_,nodes);
+	}
+}
+/*----------------------------------------------------------------------------*/
+template<typename TMesh>
+template<int TNbNodes>
+void LimaReader<TMesh>::readRegionsFixed(Lima::Maillage& ALimaMesh,
+										 std::vector<Region>& ARegions)
+{
+	Node nodes[TNbNodes];
+	for(Lima::size_type i = 0; i < ALimaMesh.nb_polyedres(); i++)
+	{
+		const std::size_t index = cellIndex(i);
+		Lima::Polyedre  p = ALimaMesh.polyedre(index);
+		if(preserve_ids_)
+			fillRegionHoles(p.id(),getNode(p.noeud(0).id()));
+		for(int k = 0; k < TNbNodes; k++)
+			nodes[k] = getNode(p.noeud(k).id());
+
+		ARegions[index] = LimaRegionBuilder<TNbNodes>::build(this->mesh_,nodes);
+	}
+}
+/*----------------------------------------------------------------------------*/
+template<typename TMesh>
+void LimaReader<TMesh>::fillNodeHoles(const Lima::id_type AID)
+{
+	while(static_cast<Lima::id_type>(this->mesh_.getNbNodes())+1 < AID)
+		node_holes_.push_back(this->mesh_.newNode(0,0,0));
+}
+/*----------------------------------------------------------------------------*/
+template<typename TMesh>
+void LimaReader<TMesh>::fillEdgeHoles(const Lima::id_type AID, const Node& ANode)
+{
+	while(static_cast<Lima::id_type>(this->mesh_.getNbEdges())+1 < AID)
+		edge_holes_.push_back(this->mesh_.newEdge(ANode,ANode));
+}
+/*----------------------------------------------------------------------------*/
+template<typename TMesh>
+void LimaReader<TMesh>::fillFaceHoles(const Lima::id_type AID, const Node& ANode)
+{
+	while(static_cast<Lima::id_type>(this->mesh_.getNbFaces())+1 < AID)
+		face_holes_.push_back(this->mesh_.newTriangle(ANode,ANode,ANode));
+}
+/*----------------------------------------------------------------------------*/
+template<typename TMesh>
+void LimaReader<TMesh>::fillRegionHoles(const Lima::id_type AID, const Node& ANode)
+{
+	while(static_cast<Lima::id_type>(this->mesh_.getNbRegions())+1 < AID)
+		region_holes_.push_back(this->mesh_.newTet(ANode,ANode,ANode,ANode));
+}
+/*----------------------------------------------------------------------------*/
+template<typename TMesh>
+Variable<Lima::id_type>* LimaReader<TMesh>::getLimaIDVariable(const ECellType AType)
+{
+	// the variable exists if the mesh was already read with a renumbering
+	try {
+		return this->mesh_.template getVariable<Lima::id_type>(AType,"lima_id");
+	}
+	catch(GMDSException&) {
+		return this->mesh_.template newVariable<Lima::id_type>(AType,"lima_id");
+	}
+}
+/*----------------------------------------------------------------------------*/
+template<typename TMesh>
+void LimaReader<TMesh>::sortByID(const std::vector<uint64_t>& AIDs)
+{
+	for(Lima::size_type i = 1; i < AIDs.size(); i++)
+	{
+		if(AIDs[i]<AIDs[i-1])
+		{
+			SpaceFillingCurve::sort(AIDs,cells_order_);
+			return;
+		}
+	}
+}
+/*----------------------------------------------------------------------------*/
+template<typename TMesh>
+template<typename TLimaCell>
+uint64_t LimaReader<TMesh>::getCentroidKey(const TLimaCell& ACell) const
+{
+	double x = 0., y = 0., z = 0.;
+	const unsigned int nb = ACell.nb_noeuds();
+	for(Lima::size_type k = 0; k < nb; k++)
+	{
+		Lima::Noeud n = ACell.noeud(k);
+		x += n.x();
+		y += n.y();
+		z += n.z();
+	}
+	return curve_.key(x/nb,y/nb,z/nb);
+}
+/*----------------------------------------------------------------------------*/
 }
 /*----------------------------------------------------------------------------*/
 #endif /* LIMAREADER_H_ */
@@ -27,12 +27,37 @@ public:
 	 */
 	double getLengthUnit();
 
+	/*------------------------------------------------------------------------*/
+	/** \brief  Create the nodes and cells in the order of a space-filling
+	 *  		curve instead of the file order. The Lima ids are then kept in
+	 *  		the Lima::id_type variables named "lima_id" of each read dimension,
+	 *  		created by the first read and reused by the following ones.
+	 */
+	void setRenumbering(ERenumbering ARenumbering);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Restart mode: every node and cell gets the gmds id it had
+	 *  		when it was written by LimaWriterAPI (Lima id - 1), holes
+	 *  		included, so that variables and external tables indexed by
+	 *  		gmds ids remain valid. The holes after the last id are
+	 *  		restored as well when the metadata file written with the mesh
+	 *  		(see LimaMetaFile) is present. The mesh must be empty before
+	 *  		reading and the ids must not have been renumbered when writing.
+	 */
+	void setPreserveIDs(bool APreserve);
+
     /*------------------------------------------------------------------------*/
     /** \brief  Read the content of the file named outputName_ and write it in
      *   		mesh_.
      */
 	void read(const std::string& AFileName, gmds::MeshModel AModel);
 
+	/*------------------------------------------------------------------------*/
+	/** \brief  Read a mesh from the ASize bytes of AData, that are the
+	 *  		content of a mli2 file (see LimaWriterAPI::writeToBuffer).
+	 */
+	void readFromBuffer(const char* AData, std::size_t ASize, gmds::MeshModel AModel);
+
 protected:
 
 	void readNodes(Lima::Maillage& ALimaMesh);
@@ -40,12 +65,75 @@ protected:
 	void readFaces(Lima::Maillage& ALimaMesh);
 	void readRegions(Lima::Maillage& ALimaMesh);
 
+	/*------------------------------------------------------------------------*/
+	/** \brief  Read kernels for Lima meshes whose polygons (resp. polyhedra)
+	 *  		all have TNbNodes nodes. No per-cell branching is done.
+	 */
+	template<int TNbNodes>
+	void readFacesFixed(Lima::Maillage& ALimaMesh, std::vector<Face>& AFaces);
+	template<int TNbNodes>
+	void readRegionsFixed(Lima::Maillage& ALimaMesh, std::vector<Region>& ARegions);
+
+	/* restart mode: create placeholder cells until the next created node
+	 * (resp. cell) gets the gmds id AID-1. ANode is an existing node used to
+	 * build the placeholders */
+	void fillNodeHoles(const Lima::id_type AID);
+	void fillEdgeHoles(const Lima::id_type AID, const Node& ANode);
+	void fillFaceHoles(const Lima::id_type AID, const Node& ANode);
+	void fillRegionHoles(const Lima::id_type AID, const Node& ANode);
 
-	/* connection between original nodes ID and GMDS nodes */
+	/* set cells_order_ so that the cells are created by increasing Lima
+	 * ids, cells_order_ stays empty if they already are */
+	void sortByID(const std::vector<uint64_t>& AIDs);
+
+	/* variable "lima_id" of the cells of type AType, created if the mesh
+	 * does not have it yet */
+	Variable<Lima::id_type>* getLimaIDVariable(const ECellType AType);
+
+	/* key of the centroid of a Lima cell along curve_ */
+	template<typename TLimaCell>
+	uint64_t getCentroidKey(const TLimaCell& ACell) const;
+
+	/* index of the i-th Lima cell to create */
+	std::size_t cellIndex(const std::size_t AI) const {
+		return cells_order_.empty()?AI:cells_order_[AI];
+	}
+
+
+	/* gmds node of the Lima node id AID */
+	const Node& getNode(const Lima::id_type AID) const {
+		return nodes_connection_[nodes_index_(AID)];
+	}
+
+	/* GMDS nodes by position of the Lima nodes in the file, and position
+	 * of each Lima node id */
 	std::vector<Node> nodes_connection_;
+	LimaIDIndex nodes_index_;
 
 	/* length unit */
 	double lenghtUnit_;
+
+	/* renumbering applied when reading */
+	ERenumbering renumbering_;
+	SpaceFillingCurve curve_;
+
+	/* creation order of the Lima cells of the dimension being read, empty
+	 * for the file order */
+	std::vector<std::size_t> cells_order_;
+
+	/* restart mode */
+	bool preserve_ids_;
+
+	/* restart mode: id capacity of each dimension, read in the metadata
+	 * file, 0 if unknown */
+	Lima::id_type id_capacities_[4];
+
+	/* placeholder cells created to preserve the ids, deleted once each
+	 * dimension is read */
+	std::vector<Node> node_holes_;
+	std::vector<Edge> edge_holes_;
+	std::vector<Face> face_holes_;
+	std::vector<Region> region_holes_;
 };
 /*----------------------------------------------------------------------------*/
 
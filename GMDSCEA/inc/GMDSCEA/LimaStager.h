@@ -0,0 +1,127 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaStager.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMASTAGER_H_
+#define GMDS_LIMASTAGER_H_
+/*----------------------------------------------------------------------------*/
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Staging of the written files in a scratch directory, typically
+ *          on a local disk, before their move to their final path, typically
+ *          on a parallel file system.
+ *
+ *          The file is first written under getStagedPath, then migrate
+ *          queues its move, done by a pool of background threads: a rename
+ *          when both paths are on the same file system, a copy to a
+ *          temporary file renamed at the end otherwise (see
+ *          LimaAtomicFile). The metadata file (see LimaMetaFile) follows its
+ *          mesh file. The final file is synced to disk before the staged
+ *          file is removed.
+ *
+ *          When a migration fails, the staged files and the partial copy
+ *          are removed, the previous final file is left untouched and the
+ *          error is reported by the next barrier.
+ *
+ *          The threads only move files, they do not call HDF5.
+ */
+class LimaStager{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor, creates the scratch directory if needed.
+	 *
+	 *  \param AScratchDir the directory where the files are staged.
+	 *  \param ANbThreads  the number of files migrated at the same time.
+	 */
+	LimaStager(const std::string& AScratchDir, int ANbThreads=2);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor, waits for the end of the migrations.	*/
+	virtual ~LimaStager();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  New path of the scratch directory where the file AFileName
+	 *          can be written. It keeps the suffix of AFileName so that Lima
+	 *          detects the same format.
+	 */
+	std::string getStagedPath(const std::string& AFileName);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Queue the move of the staged file AStagedPath, and of its
+	 *          metadata file if any, to AFileName. A migration to AFileName
+	 *          still pending is waited for first, so that the last file
+	 *          staged is the one kept.
+	 */
+	void migrate(const std::string& AStagedPath, const std::string& AFileName);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Wait for the end of the migrations to AFileName.
+	 */
+	void wait(const std::string& AFileName);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Wait for the end of all the migrations queued. Returns true
+	 *          if those ended since the previous barrier all succeeded, the
+	 *          files are then on disk at their final path.
+	 */
+	bool barrier();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Description of the migrations that failed, as reported by the
+	 *          last barrier.
+	 */
+	const std::vector<std::string>& getErrors() const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Number of migrations queued or running.
+	 */
+	int getNbPending() const;
+
+protected:
+
+	/* loop of the migration threads */
+	void run();
+
+	/* move of a staged file and its metadata to AFileName, throws a
+	 * GMDSException on failure */
+	void move(const std::string& AStagedPath, const std::string& AFileName);
+
+	/* scratch directory */
+	std::string scratchDir_;
+
+	/* number of paths given by getStagedPath */
+	int nbStaged_;
+
+	/* migrations queued (staged path, final path), and final paths of the
+	 * migrations queued or running */
+	std::deque<std::pair<std::string,std::string> > queue_;
+	std::multiset<std::string> pending_;
+
+	/* errors of the migrations ended since the last barrier, and those
+	 * reported by the last barrier */
+	std::vector<std::string> errors_;
+	std::vector<std::string> lastErrors_;
+
+	bool stop_;
+	mutable std::mutex mutex_;
+	std::condition_variable queued_;
+	std::condition_variable done_;
+	std::vector<std::thread> threads_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMASTAGER_H_
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,78 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaTranscoder.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMATRANSCODER_H_
+#define GMDS_LIMATRANSCODER_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+/*----------------------------------------------------------------------------*/
+#include <Lima/lima++.h>
+#include <Lima/malipp2.h>
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaChunkWriter.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Conversion of a Lima file of any format into the mli2 format,
+ *          without building a gmds mesh.
+ *
+ *          The nodes, cells and groups of the source are streamed into a
+ *          LimaChunkWriter, keeping their ids, so that the output is written
+ *          atomically as by the other mli2 writers. The source is
+ *          loaded by Lima::Maillage since Lima offers no streaming reader for
+ *          the legacy formats, so the memory used is the one of the Lima
+ *          mesh plus one chunk.
+ */
+class LimaTranscoder{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor.
+	 */
+	LimaTranscoder();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor.	*/
+	virtual ~LimaTranscoder();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the number of cells sent to the writer at once.
+	 */
+	void setChunkSize(Lima::id_type AChunkSize);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Convert AInput into the mli2 file AOutput.
+	 */
+	void transcode(const std::string& AInput, const std::string& AOutput);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Number of nodes (0), edges (1), faces (2) or regions (3)
+	 *          written by the last call to transcode.
+	 */
+	Lima::id_type getNbCells(int ADim) const;
+
+protected:
+
+	void writeNodes(Lima::Maillage& AMesh);
+	void writeEdges(Lima::Maillage& AMesh);
+	void writeFaces(Lima::Maillage& AMesh);
+	void writeRegions(Lima::Maillage& AMesh);
+
+	void writeClouds(Lima::Maillage& AMesh);
+	void writeLines(Lima::Maillage& AMesh);
+	void writeSurfaces(Lima::Maillage& AMesh);
+	void writeVolumes(Lima::Maillage& AMesh);
+
+	Lima::id_type nbCells_[4];
+
+	/* emission of the chunks */
+	LimaChunkWriter chunks_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMATRANSCODER_H_
+/*----------------------------------------------------------------------------*/
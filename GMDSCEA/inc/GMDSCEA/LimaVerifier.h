@@ -0,0 +1,75 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaVerifier.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMAVERIFIER_H_
+#define GMDS_LIMAVERIFIER_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+#include <vector>
+#include <stdint.h>
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/FlatMesh.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Check of a file written by LimaWriterAPI with
+ *          WriterOptions::verify against the chunk checksums stored in its
+ *          metadata.
+ *
+ *          The file is read into flat arrays (see LimaFlatReader), no gmds
+ *          mesh is built, then the chunks are hashed in parallel. Lima
+ *          reading the file as a whole, the read itself is sequential.
+ */
+class LimaVerifier{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor.	*/
+	LimaVerifier();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor.	*/
+	virtual ~LimaVerifier();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the number of threads hashing the chunks, 0 (the default)
+	 *          means the number of hardware threads.
+	 */
+	void setNbThreads(int ANbThreads);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Check the file AFileName, returns true if all its chunks
+	 *          match their checksum. Throws a GMDSException if the file has
+	 *          no chunk checksums.
+	 */
+	bool verify(const std::string& AFileName);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Description of the mismatches found by the last verify.
+	 */
+	const std::vector<std::string>& getErrors() const;
+
+protected:
+
+	/* checks the chunks of dimension ADim of mesh_ */
+	void verifyDim(int ADim, Lima::id_type AChunkSize,
+				   const std::vector<uint64_t>& AChecksums);
+
+	/* checksum of the chunk [AFirst, ALast) of dimension ADim of mesh_ */
+	uint64_t hashChunk(int ADim, std::size_t AFirst, std::size_t ALast,
+					   std::vector<Lima::id_type>& ABuffer) const;
+
+	int nbThreads_;
+
+	FlatMesh mesh_;
+
+	std::vector<std::string> errors_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMAVERIFIER_H_
+/*----------------------------------------------------------------------------*/
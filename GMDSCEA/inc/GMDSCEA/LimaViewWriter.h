@@ -0,0 +1,186 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaViewWriter.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_LIMAVIEWWRITER_H_
+#define GMDS_LIMAVIEWWRITER_H_
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <Lima/malipp2.h>
+#include <GMDS/IG/IG.h>
+#include "GMDSCEA/LimaChunkWriter.h"
+#include "GMDSCEA/LimaMetaFile.h"
+#include "GMDSCEA/LimaWriterAPI.h"
+#include "GMDSCEA/MeshStatistics.h"
+#include "GMDSCEA/WriterOptions.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+#include "LimaViewWriter_def.h"
+/*----------------------------------------------------------------------------*/
+template<typename TView>
+LimaViewWriter<TView>::LimaViewWriter(const TView& AView)
+:view_(AView),lenghtUnit_(1.)
+{}
+/*----------------------------------------------------------------------------*/
+template<typename TView>
+LimaViewWriter<TView>::~LimaViewWriter()
+{}
+/*----------------------------------------------------------------------------*/
+template<typename TView>
+void LimaViewWriter<TView>::setLengthUnit(double AUnit)
+{
+	lenghtUnit_ = AUnit;
+}
+/*----------------------------------------------------------------------------*/
+template<typename TView>
+void LimaViewWriter<TView>::setChunkSize(Lima::id_type AChunkSize)
+{
+	if(AChunkSize == 0) {
+		throw GMDSException("LimaViewWriter::setChunkSize the chunk size must be positive.");
+	}
+	chunks_.setChunkSize(AChunkSize);
+}
+/*----------------------------------------------------------------------------*/
+template<typename TView>
+void LimaViewWriter<TView>::setOptions(const WriterOptions& AOptions)
+{
+	try {
+		chunks_.setOptions(AOptions);
+	}
+	catch(GMDSException& e) {
+		throw GMDSException(std::string("LimaViewWriter::setOptions ")+e.what());
+	}
+}
+/*----------------------------------------------------------------------------*/
+template<typename TView>
+const MeshStatistics& LimaViewWriter<TView>::getStatistics() const
+{
+	return chunks_.getStatistics();
+}
+/*----------------------------------------------------------------------------*/
+template<typename TView>
+void LimaViewWriter<TView>::releaseBuffers()
+{
+	chunks_.releaseBuffers();
+}
+/*----------------------------------------------------------------------------*/
+template<typename TView>
+void LimaViewWriter<TView>::write(const std::string& AFileName, gmds::MeshModel AModel)
+{
+	chunks_.write(AFileName, view_.getDim(), lenghtUnit_, [&]() {
+		writeNodes();
+		writeCells(1,AModel.has(E));
+		writeCells(2,AModel.has(F));
+		writeCells(3,AModel.has(R));
+
+		writeGroups(0,true);
+		writeGroups(1,AModel.has(E));
+		writeGroups(2,AModel.has(F));
+		writeGroups(3,AModel.has(R));
+	}, "LimaViewWriter::write");
+
+	LimaMetaFile meta;
+	chunks_.writeMetaFile(AFileName,meta);
+}
+/*----------------------------------------------------------------------------*/
+template<typename TView>
+void LimaViewWriter<TView>::writeNodes()
+{
+	const Lima::id_type nb = view_.getNbNodes();
+	chunks_.beginNodes(nb,true,1);
+
+	// the coordinates are copied by the view directly into the chunk
+	double* xcoords;
+	double* ycoords;
+	double* zcoords;
+	Lima::id_type* ids;
+	for(Lima::id_type start=0; start<nb;) {
+		const Lima::id_type chunkSize =
+				std::min(chunks_.getNodeChunk(xcoords,ycoords,zcoords,ids), nb-start);
+		view_.getCoordinates(start,chunkSize,xcoords,ycoords,zcoords);
+		for(Lima::id_type i=0; i<chunkSize; i++) {
+			ids[i] = start+i+1;
+		}
+		chunks_.addNodes(chunkSize);
+		start += chunkSize;
+	}
+
+	chunks_.endNodes();
+}
+/*----------------------------------------------------------------------------*/
+template<typename TView>
+void LimaViewWriter<TView>::writeCells(int ADim, bool AWrite)
+{
+	const Lima::id_type nb = AWrite?view_.getNbCells(ADim):0;
+	chunks_.beginCells(ADim,nb,true,1);
+
+	for(Lima::id_type cell=0; cell<nb; cell++) {
+		Lima::Polyedre::PolyedreType regionType = Lima::Polyedre::TETRAEDRE;
+		if(ADim != 1) {
+			const gmds::ECellType type = view_.getType(ADim,cell);
+			if(ADim == 3) {
+				regionType = LimaWriterAPI::getLimaRegionType(type);
+			}
+			chunks_.addCellType(type);
+		}
+
+		const Lima::id_type nbCellNodes = view_.getNbNodes(ADim,cell);
+		Lima::id_type* cell2nodes = chunks_.addCell(cell+1,nbCellNodes,regionType);
+		view_.getNodes(ADim,cell,cell2nodes);
+		for(Lima::id_type k=0; k<nbCellNodes; k++) {
+			cell2nodes[k]++; // +1 because mli ids begin at 1
+		}
+	}
+
+	chunks_.endCells();
+}
+/*----------------------------------------------------------------------------*/
+template<typename TView>
+void LimaViewWriter<TView>::writeGroups(int ADim, bool AWrite)
+{
+	const std::size_t nbGroups = AWrite?view_.getNbGroups(ADim):0;
+
+	std::vector<std::string> names;
+	std::vector<Lima::id_type> sizes;
+	for(std::size_t iGroup=0; iGroup<nbGroups; iGroup++) {
+		names.push_back(view_.getGroupName(ADim,iGroup));
+		sizes.push_back(view_.getGroupSize(ADim,iGroup));
+	}
+	chunks_.beginGroups(ADim,names,sizes);
+
+	Lima::id_type* ids;
+	Lima::id_type* nbNodes;
+	Lima::Polyedre::PolyedreType* types;
+	for(std::size_t iGroup=0; iGroup<nbGroups; iGroup++) {
+		chunks_.beginGroup(names[iGroup]);
+		const Lima::id_type nb = sizes[iGroup];
+		for(Lima::id_type start=0; start<nb;) {
+			const Lima::id_type chunkSize =
+					std::min(chunks_.getGroupChunk(ids,nbNodes,types), nb-start);
+			view_.getGroupCells(ADim,iGroup,start,chunkSize,ids);
+			for(Lima::id_type i=0; i<chunkSize; i++) {
+				if(ADim == 2) {
+					nbNodes[i] = view_.getNbNodes(ADim,ids[i]);
+				}
+				else if(ADim == 3) {
+					types[i] = LimaWriterAPI::getLimaRegionType(view_.getType(ADim,ids[i]));
+				}
+				ids[i]++; // +1 because mli ids begin at 1
+			}
+			chunks_.addGroupCells(chunkSize);
+			start += chunkSize;
+		}
+		chunks_.endGroup();
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_LIMAVIEWWRITER_H_
+/*----------------------------------------------------------------------------*/
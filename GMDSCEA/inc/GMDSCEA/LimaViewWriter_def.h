@@ -0,0 +1,92 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaViewWriter_def.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+/** \brief  Writer of a mesh view (see SoAMeshView and IGMeshView) into a
+ *          mli2 file.
+ *
+ *          Nodes and cells are written in the order of their indices in the
+ *          view, the Lima id of the entity of index i being i+1, so that no
+ *          id array is stored. Nothing but one chunk of each kind of data is
+ *          copied, the view filling the chunk buffers directly.
+ *
+ *          The chunks are emitted by LimaChunkWriter, as for LimaWriterAPI:
+ *          the file is written atomically, statistics are computed and the
+ *          storage options of WriterOptions are applied, except the
+ *          renumbering and the compaction since the ids of a view are
+ *          contiguous and in the order of the view.
+ */
+template<typename TView>
+class LimaViewWriter{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor.
+	 *
+	 *  \param AView the mesh view we want to write into a file.
+	 */
+	LimaViewWriter(const TView& AView);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor.	*/
+	virtual ~LimaViewWriter();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the mesh length unit. It is the conversion factor from meters
+	 */
+	void setLengthUnit(double AUnit);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the number of entities sent to the writer at once.
+	 */
+	void setChunkSize(Lima::id_type AChunkSize);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the storage options (number of entities written at once,
+	 *          compression, coordinates precision, metadata), see
+	 *          WriterOptions. Throws a GMDSException, without changing the
+	 *          options, if they cannot be applied (see
+	 *          LimaWriterAPI::checkOptions).
+	 */
+	void setOptions(const WriterOptions& AOptions);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Write the view into the file named AFileName. Only the
+	 *          dimensions of AModel (N, E, F, R) are written. AFileName is
+	 *          either the previous file or the new one, never a partial
+	 *          file.
+	 */
+	void write(const std::string& AFileName, gmds::MeshModel AModel);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Statistics of the last write, see LimaWriterAPI::getStatistics.
+	 */
+	const MeshStatistics& getStatistics() const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Free the chunk buffers.
+	 */
+	void releaseBuffers();
+
+protected:
+
+	void writeNodes();
+
+	/* cells of dimension ADim (1, 2 or 3), none if !AWrite */
+	void writeCells(int ADim, bool AWrite);
+
+	/* groups of dimension ADim (0 to 3), none if !AWrite */
+	void writeGroups(int ADim, bool AWrite);
+
+	/* a mesh view */
+	const TView& view_;
+
+	/* length unit */
+	double lenghtUnit_;
+
+	/* emission of the chunks, with the storage options */
+	LimaChunkWriter chunks_;
+};
+/*----------------------------------------------------------------------------*/
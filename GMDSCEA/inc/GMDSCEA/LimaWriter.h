@@ -11,6 +11,7 @@
 /*----------------------------------------------------------------------------*/
 #include "Lima/lima++.h"
 #include <GMDS/IG/IG.h>
+#include "GMDSCEA/LimaIDs.h"
 /*----------------------------------------------------------------------------*/
 namespace gmds{
 /*----------------------------------------------------------------------------*/
@@ -86,7 +87,7 @@ void LimaWriter<TMesh>::writeNodes(Lima::Maillage& ALimaMesh)
 	for(;!it_nodes.isDone();it_nodes.next())
 	{
 		Node n = it_nodes.value();
-		Lima::Noeud n2(n.getID()+1,n.X(), n.Y(), n.Z());
+		Lima::Noeud n2(toLimaID(n.getID()),n.X(), n.Y(), n.Z());
 		/* we keep the connection between lima node and gmds node through local ids.
 		 */
 		ALimaMesh.ajouter(n2);
@@ -103,7 +104,7 @@ void LimaWriter<TMesh>::writeNodes(Lima::Maillage& ALimaMesh)
 		ALimaMesh.ajouter(lima_cl);
 
 		std::vector<Node> nodes= cl.cells();
-		for(unsigned int node_index=0; node_index<nodes.size();node_index++)
+		for(std::size_t node_index=0; node_index<nodes.size();node_index++)
 	        lima_cl.ajouter(nodes_connection_[nodes[node_index].getID()]);
 	}
 
@@ -121,7 +122,7 @@ void LimaWriter<TMesh>::writeEdges(Lima::Maillage& ALimaMesh)
 		std::vector<TCellID> nodes = e.getIDs<Node>();
 		Lima::Noeud n1 = nodes_connection_[nodes[0]];
 		Lima::Noeud n2 = nodes_connection_[nodes[1]];
-		Lima::Bras e2(e.getID()+1,n1, n2);
+		Lima::Bras e2(toLimaID(e.getID()),n1, n2);
 		ALimaMesh.ajouter(e2);
 	}
 
@@ -134,8 +135,8 @@ void LimaWriter<TMesh>::writeEdges(Lima::Maillage& ALimaMesh)
 		ALimaMesh.ajouter(lima_li);
 
 		std::vector<Edge> edges= li.cells();
-		for(unsigned int index=0; index<edges.size();index++){
-			Lima::Bras b = ALimaMesh.bras_id(edges[index].getID()+1);
+		for(std::size_t index=0; index<edges.size();index++){
+			Lima::Bras b = ALimaMesh.bras_id(toLimaID(edges[index].getID()));
 	        lima_li.ajouter(b);
 		}
 	}
@@ -158,7 +159,7 @@ void LimaWriter<TMesh>::writeFaces(Lima::Maillage& ALimaMesh)
 			Lima::Noeud n2 = nodes_connection_[nodes[1]];
 			Lima::Noeud n3 = nodes_connection_[nodes[2]];
 			Lima::Noeud n4 = nodes_connection_[nodes[3]];
-			Lima::Polygone f2(f.getID()+1,n1, n2,n3,n4);
+			Lima::Polygone f2(toLimaID(f.getID()),n1, n2,n3,n4);
 			ALimaMesh.ajouter(f2);}
 			break;
 		case GMDS_TRIANGLE:{
@@ -166,7 +167,7 @@ void LimaWriter<TMesh>::writeFaces(Lima::Maillage& ALimaMesh)
 			Lima::Noeud n2 = nodes_connection_[nodes[1]];
 			Lima::Noeud n3 = nodes_connection_[nodes[2]];
 
-			Lima::Polygone f2(f.getID()+1,n1, n2,n3);
+			Lima::Polygone f2(toLimaID(f.getID()),n1, n2,n3);
 			ALimaMesh.ajouter(f2);}
 			break;
 		case GMDS_POLYGON:{
@@ -176,7 +177,7 @@ void LimaWriter<TMesh>::writeFaces(Lima::Maillage& ALimaMesh)
 					Lima::Noeud n1 = nodes_connection_[nodes[0]];
 					Lima::Noeud n2 = nodes_connection_[nodes[1]];
 					Lima::Noeud n3 = nodes_connection_[nodes[2]];
-					Lima::Polygone f2(f.getID()+1,n1, n2, n3);
+					Lima::Polygone f2(toLimaID(f.getID()),n1, n2, n3);
 					ALimaMesh.ajouter(f2);
 				}
 				break;
@@ -186,7 +187,7 @@ void LimaWriter<TMesh>::writeFaces(Lima::Maillage& ALimaMesh)
 					Lima::Noeud n2 = nodes_connection_[nodes[1]];
 					Lima::Noeud n3 = nodes_connection_[nodes[2]];
 					Lima::Noeud n4 = nodes_connection_[nodes[3]];
-					Lima::Polygone f2(f.getID()+1,n1, n2, n3, n4);
+					Lima::Polygone f2(toLimaID(f.getID()),n1, n2, n3, n4);
 					ALimaMesh.ajouter(f2);
 				}
 				break;
@@ -197,7 +198,7 @@ void LimaWriter<TMesh>::writeFaces(Lima::Maillage& ALimaMesh)
 					Lima::Noeud n3 = nodes_connection_[nodes[2]];
 					Lima::Noeud n4 = nodes_connection_[nodes[3]];
 					Lima::Noeud n5 = nodes_connection_[nodes[4]];
-					Lima::Polygone f2(f.getID()+1,n1, n2, n3, n4, n5);
+					Lima::Polygone f2(toLimaID(f.getID()),n1, n2, n3, n4, n5);
 					ALimaMesh.ajouter(f2);
 				}
 				break;
@@ -209,7 +210,7 @@ void LimaWriter<TMesh>::writeFaces(Lima::Maillage& ALimaMesh)
 					Lima::Noeud n4 = nodes_connection_[nodes[3]];
 					Lima::Noeud n5 = nodes_connection_[nodes[4]];
 					Lima::Noeud n6 = nodes_connection_[nodes[5]];
-					Lima::Polygone f2(f.getID()+1,n1, n2, n3, n4, n5, n6);
+					Lima::Polygone f2(toLimaID(f.getID()),n1, n2, n3, n4, n5, n6);
 					ALimaMesh.ajouter(f2);
 				}
 				break;
@@ -233,9 +234,9 @@ void LimaWriter<TMesh>::writeFaces(Lima::Maillage& ALimaMesh)
 		ALimaMesh.ajouter(lima_surf);
 
 		std::vector<Face> faces = surf.cells();
-		for(unsigned int face_index=0; face_index<faces.size();face_index++)
+		for(std::size_t face_index=0; face_index<faces.size();face_index++)
 		{
-			Lima::Polygone p = ALimaMesh.polygone_id(faces[face_index].getID()+1);
+			Lima::Polygone p = ALimaMesh.polygone_id(toLimaID(faces[face_index].getID()));
 	        lima_surf.ajouter(p);
 		}
 	}
@@ -258,7 +259,7 @@ void LimaWriter<TMesh>::writeRegions(Lima::Maillage& ALimaMesh)
 			Lima::Noeud n3 = nodes_connection_[nodes[2]];
 			Lima::Noeud n4 = nodes_connection_[nodes[3]];
 
-			Lima::Polyedre f2(g.getID()+1,n1,n2,n3,n4);
+			Lima::Polyedre f2(toLimaID(g.getID()),n1,n2,n3,n4);
 			ALimaMesh.ajouter(f2);
 		}
 		break;
@@ -274,7 +275,7 @@ void LimaWriter<TMesh>::writeRegions(Lima::Maillage& ALimaMesh)
 			Lima::Noeud n8 = nodes_connection_[nodes[7]];
 
 
-			Lima::Polyedre f2(g.getID()+1,n1,n2,n3,n4,n5,n6,n7,n8);
+			Lima::Polyedre f2(toLimaID(g.getID()),n1,n2,n3,n4,n5,n6,n7,n8);
 			ALimaMesh.ajouter(f2);
 		}
 		break;
@@ -287,7 +288,7 @@ void LimaWriter<TMesh>::writeRegions(Lima::Maillage& ALimaMesh)
 			Lima::Noeud n5 = nodes_connection_[nodes[4]];
 
 
-			Lima::Polyedre f2(g.getID()+1,n1,n2,n3,n4,n5);
+			Lima::Polyedre f2(toLimaID(g.getID()),n1,n2,n3,n4,n5);
 			ALimaMesh.ajouter(f2);
 		}
 		break;
@@ -300,7 +301,7 @@ void LimaWriter<TMesh>::writeRegions(Lima::Maillage& ALimaMesh)
 			Lima::Noeud n5 = nodes_connection_[nodes[4]];
 			Lima::Noeud n6 = nodes_connection_[nodes[5]];
 
-			Lima::Polyedre f2(g.getID()+1,n1,n2,n3,n4,n5,n6);
+			Lima::Polyedre f2(toLimaID(g.getID()),n1,n2,n3,n4,n5,n6);
 			ALimaMesh.ajouter(f2);
 		}
 		break;
@@ -318,7 +319,7 @@ void LimaWriter<TMesh>::writeRegions(Lima::Maillage& ALimaMesh)
 			Lima::Noeud n9 = nodes_connection_[nodes[8]];
 			Lima::Noeud n10= nodes_connection_[nodes[9]];
 
-			Lima::Polyedre f2(g.getID()+1,n1,n2,n3,n4,n5,n6,n7,n8,n9,n10);
+			Lima::Polyedre f2(toLimaID(g.getID()),n1,n2,n3,n4,n5,n6,n7,n8,n9,n10);
 			ALimaMesh.ajouter(f2);
 		}
 		break;
@@ -338,7 +339,7 @@ void LimaWriter<TMesh>::writeRegions(Lima::Maillage& ALimaMesh)
 			Lima::Noeud n11= nodes_connection_[nodes[10]];
 			Lima::Noeud n12= nodes_connection_[nodes[11]];
 
-			Lima::Polyedre f2(g.getID()+1,n1,n2,n3,n4,n5,n6,n7,n8,n9,n10,n11,n12);
+			Lima::Polyedre f2(toLimaID(g.getID()),n1,n2,n3,n4,n5,n6,n7,n8,n9,n10,n11,n12);
 			ALimaMesh.ajouter(f2);
 		}
 		break;
@@ -350,7 +351,7 @@ void LimaWriter<TMesh>::writeRegions(Lima::Maillage& ALimaMesh)
 				Lima::Noeud n2 = nodes_connection_[nodes[1]];
 				Lima::Noeud n3 = nodes_connection_[nodes[2]];
 				Lima::Noeud n4 = nodes_connection_[nodes[3]];
-				Lima::Polyedre f2(g.getID()+1,n1, n2, n3, n4);
+				Lima::Polyedre f2(toLimaID(g.getID()),n1, n2, n3, n4);
 				ALimaMesh.ajouter(f2);
 			}
 			break;
@@ -361,7 +362,7 @@ void LimaWriter<TMesh>::writeRegions(Lima::Maillage& ALimaMesh)
 				Lima::Noeud n3 = nodes_connection_[nodes[2]];
 				Lima::Noeud n4 = nodes_connection_[nodes[3]];
 				Lima::Noeud n5 = nodes_connection_[nodes[4]];
-				Lima::Polyedre f2(g.getID()+1,n1, n2, n3, n4, n5);
+				Lima::Polyedre f2(toLimaID(g.getID()),n1, n2, n3, n4, n5);
 				ALimaMesh.ajouter(f2);
 			}
 			break;
@@ -373,7 +374,7 @@ void LimaWriter<TMesh>::writeRegions(Lima::Maillage& ALimaMesh)
 				Lima::Noeud n4 = nodes_connection_[nodes[3]];
 				Lima::Noeud n5 = nodes_connection_[nodes[4]];
 				Lima::Noeud n6 = nodes_connection_[nodes[5]];
-				Lima::Polyedre f2(g.getID()+1,n1, n2, n3, n4, n5, n6);
+				Lima::Polyedre f2(toLimaID(g.getID()),n1, n2, n3, n4, n5, n6);
 				ALimaMesh.ajouter(f2);
 			}
 			break;
@@ -387,7 +388,7 @@ void LimaWriter<TMesh>::writeRegions(Lima::Maillage& ALimaMesh)
 				Lima::Noeud n6 = nodes_connection_[nodes[5]];
 				Lima::Noeud n7 = nodes_connection_[nodes[6]];
 				Lima::Noeud n8 = nodes_connection_[nodes[7]];
-				Lima::Polyedre f2(g.getID()+1,n1, n2, n3, n4 , n5 , n6, n7, n8);
+				Lima::Polyedre f2(toLimaID(g.getID()),n1, n2, n3, n4 , n5 , n6, n7, n8);
 				ALimaMesh.ajouter(f2);
 			}
 			break;
@@ -403,7 +404,7 @@ void LimaWriter<TMesh>::writeRegions(Lima::Maillage& ALimaMesh)
 				Lima::Noeud n8 = nodes_connection_[nodes[7 ]];
 				Lima::Noeud n9 = nodes_connection_[nodes[8 ]];
 				Lima::Noeud n10= nodes_connection_[nodes[9 ]];
-				Lima::Polyedre f2(g.getID()+1,n1, n2, n3, n4 , n5 , n6, n7, n8, n9, n10);
+				Lima::Polyedre f2(toLimaID(g.getID()),n1, n2, n3, n4 , n5 , n6, n7, n8, n9, n10);
 				ALimaMesh.ajouter(f2);
 			}
 			break;
@@ -421,7 +422,7 @@ void LimaWriter<TMesh>::writeRegions(Lima::Maillage& ALimaMesh)
 				Lima::Noeud n10= nodes_connection_[nodes[9 ]];
 				Lima::Noeud n11= nodes_connection_[nodes[10]];
 				Lima::Noeud n12= nodes_connection_[nodes[11]];
-				Lima::Polyedre f2(g.getID()+1,n1, n2, n3, n4 , n5 , n6,
+				Lima::Polyedre f2(toLimaID(g.getID()),n1, n2, n3, n4 , n5 , n6,
 								  n7, n8, n9, n10, n11, n12);
 				ALimaMesh.ajouter(f2);
 			}
@@ -445,9 +446,9 @@ void LimaWriter<TMesh>::writeRegions(Lima::Maillage& ALimaMesh)
 		ALimaMesh.ajouter(lima_vol);
 
 		std::vector<Region> regions= vol.cells();
-		for(unsigned int region_index=0; region_index<regions.size();region_index++)
+		for(std::size_t region_index=0; region_index<regions.size();region_index++)
 		{
-			Lima::Polyedre p = ALimaMesh.polyedre_id(regions[region_index].getID()+1);
+			Lima::Polyedre p = ALimaMesh.polyedre_id(toLimaID(regions[region_index].getID()));
 	        lima_vol.ajouter(p);
 		}
 	}
@@ -10,6 +10,13 @@
 #include <Lima/malipp2.h>
 #include <GMDS/IG/IG.h>
 /*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaChunkWriter.h"
+#include "GMDSCEA/LimaIDs.h"
+#include "GMDSCEA/LimaMetaFile.h"
+#include "GMDSCEA/MeshStatistics.h"
+#include "GMDSCEA/SpaceFillingCurve.h"
+#include "GMDSCEA/WriterOptions.h"
+/*----------------------------------------------------------------------------*/
 namespace gmds{
 /*----------------------------------------------------------------------------*/
 class LimaWriterAPI{
@@ -33,16 +40,167 @@ public:
 
     /*------------------------------------------------------------------------*/
     /** \brief  Write the content of mesh_ into the file named AFileName.
+     *
+     *  The file is written under a temporary name in the same directory and
+     *  renamed when complete, so that AFileName is either the previous file
+     *  or the new one, never a partial file.
+     *
+     *  \param ACompact if true, the nodes and cells of a dimension whose ids
+     *  	   have holes are renumbered contiguously in the file (in container
+     *  	   order), so that no explicit id array is stored. The mesh itself
+     *  	   is not modified. Otherwise, and without renumbering, the file
+     *  	   keeps the gmds ids (holes included) and LimaReader can rebuild
+     *  	   the mesh with identical ids (see LimaReader::setPreserveIDs);
+     *  	   the holes after the last id are then recorded in the metadata
+     *  	   file (see LimaMetaFile).
      */
 	void write(const std::string& AFileName, gmds::MeshModel AModel, int ACompact=false);
 
 	/*------------------------------------------------------------------------*/
-	/** \brief  Activate the zlib compression.
+	/** \brief  Write the content of mesh_ in the mli2 format into ABuffer
+	 *          instead of a file, see LimaMemoryFile. No metadata file is
+	 *          written: the statistics stay available with getStatistics,
+	 *          the id capacities are lost.
+	 */
+	void writeToBuffer(std::vector<char>& ABuffer, gmds::MeshModel AModel, int ACompact=false);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Activate the zlib compression of the next writes. It is
+	 *          only applied when gmdscea is built with GMDSCEA_LIMA_HDF145
+	 *          (hdf145 extension of Lima), and ignored otherwise, see
+	 *          hasCompression.
 	 */
 	void activateZlibCompression();
 
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the storage options (number of entities written at once,
+	 *          renumbering, compaction, compression, coordinates precision),
+	 *          see WriterOptions. Throws a GMDSException, without changing
+	 *          the options, if they cannot be applied (see checkOptions).
+	 */
+	void setOptions(const WriterOptions& AOptions);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Renumber the nodes and cells along a space-filling curve in
+	 *          the written file. The mesh itself is not modified. Cells are
+	 *          ordered by the position of their centroid.
+	 */
+	void setRenumbering(ERenumbering ARenumbering);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Give the Lima id of each node, indexed by gmds id, for instance
+	 *          a global numbering shared by several partitions. It overrides
+	 *          the node ids computed by compaction or renumbering.
+	 */
+	void setNodesLimaIDs(const std::vector<Lima::id_type>& AIDs);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Lima ids given by the last write to the cells of dimension
+	 *          ADim (0 for nodes), indexed by gmds id. It is empty when the
+	 *          gmds ids were kept (Lima id = gmds id + 1).
+	 */
+	const std::vector<Lima::id_type>& getLimaIDs(int ADim) const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Statistics of the last write (bounding box, number of cells
+	 *          per type, group sizes, checksum), computed from the chunks
+	 *          written. They are also stored in the metadata of the file
+	 *          when WriterOptions::metadata is set.
+	 */
+	const MeshStatistics& getStatistics() const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Lima type of a gmds region type, throws a GMDSException for
+	 *          the types not handled by Lima.
+	 */
+	static Lima::Polyedre::PolyedreType getLimaRegionType(const gmds::ECellType AType);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Step of the quantization of tolerance ATolerance: the largest
+	 *          power of two lower than or equal to ATolerance, so that the
+	 *          quantized coordinates have their low-order mantissa bits zero.
+	 */
+	static double getQuantizationStep(const double ATolerance);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Coordinate AValue as written with the precision APrecision,
+	 *          AStep being given by getQuantizationStep when the coordinates
+	 *          are quantized.
+	 */
+	static double roundCoordinate(const double AValue, const ECoordinatePrecision APrecision,
+			const double AStep);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Activate the zlib compression of AWriter if ACompression is
+	 *          true and gmdscea is built with GMDSCEA_LIMA_HDF145.
+	 */
+	static void setCompression(Lima::MaliPPWriter2& AWriter, bool ACompression);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Whether gmdscea is built with GMDSCEA_LIMA_HDF145, that is
+	 *          whether the datasets can be compressed.
+	 */
+	static bool hasCompression();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Throws a GMDSException if AOptions cannot be applied: the
+	 *          quantization without a positive tolerance, or the compression
+	 *          or a reduced precision without GMDSCEA_LIMA_HDF145, since the
+	 *          coordinates would lose precision without any size gain.
+	 */
+	static void checkOptions(const WriterOptions& AOptions);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Free the chunk buffers. They are otherwise kept from one write
+	 *          to the next, so that repeated writes do not allocate them
+	 *          again (see WriterSession).
+	 */
+	void releaseBuffers();
+
 protected:
 
+	/*------------------------------------------------------------------------*/
+	/** \brief  Write the mesh into AFileName, see write. The metadata file
+	 *          is only written or removed if AMetaFile.
+	 */
+	void writeFile(const std::string& AFileName, gmds::MeshModel AModel,
+			int ACompact, bool AMetaFile);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Compute the writing order and the Lima ids of the nodes and
+	 *          cells when a renumbering is asked for.
+	 */
+	void computeRenumbering();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Store in AMeta the id capacity (highest gmds id + 1, holes
+	 *          included) of the dimensions written with their gmds ids.
+	 *          Returns true if one of them has holes, so that the metadata
+	 *          file is needed to restore them (see LimaReader::setPreserveIDs).
+	 */
+	bool addIDCapacities(LimaMetaFile& AMeta) const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Compute the Lima ids of the dimensions whose gmds ids are not
+	 *          contiguous, keeping the container order.
+	 */
+	void computeCompaction();
+
+	/* Lima id of the node (resp. edge, face, region) of gmds id AID; the
+	 * default is AID+1 because mli ids begin at 1 */
+	Lima::id_type nodeLimaID(const gmds::TCellID AID) const {
+		return nodeIDs_.empty()?toLimaID(AID):nodeIDs_[AID];
+	}
+	Lima::id_type edgeLimaID(const gmds::TCellID AID) const {
+		return edgeIDs_.empty()?toLimaID(AID):edgeIDs_[AID];
+	}
+	Lima::id_type faceLimaID(const gmds::TCellID AID) const {
+		return faceIDs_.empty()?toLimaID(AID):faceIDs_[AID];
+	}
+	Lima::id_type regionLimaID(const gmds::TCellID AID) const {
+		return regionIDs_.empty()?toLimaID(AID):regionIDs_[AID];
+	}
+
 	void writeNodes();
 	void writeEdges();
 	void writeFaces();
@@ -53,15 +211,20 @@ protected:
 	void writeSurfaces();
 	void writeVolumes();
 
-	void writeNodesAttributes();
-	void writeEdgesAttributes();
-	void writeFacesAttributes();
-	void writeRegionsAttributes();
+	/*------------------------------------------------------------------------*/
+	/** \brief  Checks whether all the faces (resp. regions) of mesh_ share
+	 *          the same type. In this case, the specialized kernels with a
+	 *          fixed number of nodes per cell are used.
+	 */
+	void detectFacesType();
+	void detectRegionsType();
 
-	void writeCloudsAttributes();
-	void writeLinesAttributes();
-	void writeSurfacesAttributes();
-	void writeVolumesAttributes();
+	/*------------------------------------------------------------------------*/
+	/** \brief  Write kernels for meshes whose faces (resp. regions) have all
+	 *          TNbNodes nodes. No per-cell branching is done.
+	 */
+	template<int TNbNodes> void writeFacesFixed();
+	template<int TNbNodes> void writeRegionsFixed();
 
 	/* a mesh */
 	gmds::IGMesh& mesh_;
@@ -72,7 +235,43 @@ protected:
 	/* length unit */
 	double lenghtUnit_;
 
-	Lima::MaliPPWriter2* writer_;
+	/* emission of the chunks, with the storage options but the numbering
+	 * ones, and statistics of the last write */
+	LimaChunkWriter chunks_;
+
+	/* number of nodes of all the faces, 0 if the faces are not all of the
+	 * same type */
+	int facesNbNodes_;
+
+	/* type and number of nodes of all the regions, regionsNbNodes_ is 0 if
+	 * the regions are not all of the same type */
+	int regionsNbNodes_;
+	Lima::Polyedre::PolyedreType regionsType_;
+
+	/* renumbering applied when writing */
+	ERenumbering renumbering_;
+
+	/* compaction of the ids asked for the current write */
+	bool compact_;
+
+	/* compaction asked for through setOptions */
+	bool compactOption_;
+
+	/* gmds ids of the nodes (resp. cells) in writing order, empty when the
+	 * container order is used */
+	std::vector<gmds::TCellID> nodeOrder_;
+	std::vector<gmds::TCellID> edgeOrder_;
+	std::vector<gmds::TCellID> faceOrder_;
+	std::vector<gmds::TCellID> regionOrder_;
+
+	/* node Lima ids given by the user, indexed by gmds ids */
+	std::vector<Lima::id_type> userNodeIDs_;
+
+	/* Lima ids indexed by gmds ids, empty when gmds id + 1 is used */
+	std::vector<Lima::id_type> nodeIDs_;
+	std::vector<Lima::id_type> edgeIDs_;
+	std::vector<Lima::id_type> faceIDs_;
+	std::vector<Lima::id_type> regionIDs_;
 };
 /*----------------------------------------------------------------------------*/
 }  // namespace gmds
@@ -0,0 +1,79 @@
+/*----------------------------------------------------------------------------*/
+/** \file    MeshHash.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_MESHHASH_H_
+#define GMDS_MESHHASH_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+#include <vector>
+#include <stdint.h>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  64 bits hash of the content of a mesh: coordinates, ids, types
+ *          and connectivities of the cells, and groups, for the cells kept
+ *          by a mesh model.
+ *
+ *          The cells are hashed by blocks of fixed size, in parallel, and
+ *          the block hashes are combined in order, so that the value does
+ *          not depend on the number of threads. It is not a cryptographic
+ *          hash: it detects changes, not tampering.
+ */
+class MeshHash{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor.
+	 *
+	 *  \param AMesh the mesh to hash.
+	 */
+	MeshHash(const gmds::IGMesh& AMesh);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the number of threads, 0 (the default) means the number
+	 *          of hardware threads.
+	 */
+	void setNbThreads(int ANbThreads);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Hash of the nodes, cells and groups kept by AModel.
+	 */
+	uint64_t compute(gmds::MeshModel AModel);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Combine AValue into the hash AHash.
+	 */
+	static uint64_t combine(uint64_t AHash, uint64_t AValue);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Hexadecimal form of a hash, and back.
+	 */
+	static std::string toString(uint64_t AHash);
+	static uint64_t fromString(const std::string& AString);
+
+	/* number of cells per block */
+	static const std::size_t BLOCK_SIZE = 1<<16;
+
+private:
+
+	/* hash of the cells of dimension ADim (0 for the nodes) of ids AIDs */
+	uint64_t hashCells(int ADim, const std::vector<gmds::TCellID>& AIDs);
+
+	/* hash of the cells [AFirst, ALast) of AIDs */
+	uint64_t hashBlock(int ADim, const std::vector<gmds::TCellID>& AIDs,
+					   std::size_t AFirst, std::size_t ALast) const;
+
+	const gmds::IGMesh& mesh_;
+
+	int nbThreads_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_MESHHASH_H_
+/*----------------------------------------------------------------------------*/
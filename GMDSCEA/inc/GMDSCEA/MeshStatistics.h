@@ -0,0 +1,155 @@
+/*----------------------------------------------------------------------------*/
+/** \file    MeshStatistics.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_MESHSTATISTICS_H_
+#define GMDS_MESHSTATISTICS_H_
+/*----------------------------------------------------------------------------*/
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include <stdint.h>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include <Lima/lima++.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+class LimaMetaFile;
+/*----------------------------------------------------------------------------*/
+/** \brief  Statistics of a mesh file: bounding box, number of cells per
+ *          dimension and per type, group sizes and a checksum of the
+ *          coordinates, connectivities and ids written.
+ *
+ *          LimaWriterAPI fills them from the chunks it writes, without
+ *          another pass over the mesh, and can store them in the metadata
+ *          of the file (see LimaMetaFile), where probe reads them back.
+ */
+class MeshStatistics{
+public:
+
+	MeshStatistics();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Reset all the values.
+	 */
+	void clear();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Record a checksum for each chunk of AChunkSize entities
+	 *          written, see LimaVerifier. Every chunk given to addNodes and
+	 *          addCells must then hold AChunkSize entities, but the last one
+	 *          of each dimension.
+	 */
+	void setChunkChecksums(Lima::id_type AChunkSize);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Account for a chunk of ANb nodes written.
+	 */
+	void addNodes(Lima::id_type ANb, const double* AX, const double* AY,
+				  const double* AZ, const Lima::id_type* AIDs);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Account for a chunk of ANb cells of dimension ADim written,
+	 *          of connectivity ANodes (ANbNodes ids).
+	 */
+	void addCells(int ADim, Lima::id_type ANb, const Lima::id_type* ANodes,
+				  Lima::id_type ANbNodes, const Lima::id_type* AIDs);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Account for ANb cells of type AType.
+	 */
+	void addCellType(gmds::ECellType AType, std::size_t ANb=1) {
+		nbCellsPerType_[AType] += ANb;
+	}
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Account for a group of cells of dimension ADim (0 for clouds).
+	 */
+	void addGroup(int ADim, const std::string& AName, std::size_t ASize);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Accessors.
+	 */
+	std::size_t getNbNodes() const {return nbNodes_;}
+	std::size_t getNbCells(int ADim) const {return nbCells_[ADim];}
+	std::size_t getNbCells(gmds::ECellType AType) const;
+	const std::map<gmds::ECellType,std::size_t>& getNbCellsPerType() const {
+		return nbCellsPerType_;
+	}
+	const std::vector<std::pair<std::string,std::size_t> >& getGroups(int ADim) const {
+		return groups_[ADim];
+	}
+	/* bounding box of the nodes, empty (min > max) without nodes */
+	const double* getMin() const {return min_;}
+	const double* getMax() const {return max_;}
+	/* checksum of the values written, it does not depend on the chunk size */
+	uint64_t getChecksum() const;
+	/* size of the chunks of the chunk checksums, 0 if they are not recorded */
+	Lima::id_type getChunkSize() const {return chunkSize_;}
+	/* checksums of the chunks of nodes (ADim = 0) or cells of dimension ADim */
+	const std::vector<uint64_t>& getChunkChecksums(int ADim) const {
+		return chunkChecksums_[ADim];
+	}
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Checksum of a chunk of ANb nodes, and of a chunk of ANb cells
+	 *          whose connectivity holds ANbNodes Lima ids.
+	 */
+	static uint64_t hashNodeChunk(std::size_t ANb, const double* AX, const double* AY,
+								  const double* AZ, const Lima::id_type* AIDs);
+	static uint64_t hashCellChunk(std::size_t ANb, const Lima::id_type* ANodes,
+								  std::size_t ANbNodes, const Lima::id_type* AIDs);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Store the statistics in AMeta, and read them back. fromMeta
+	 *          returns false if AMeta holds no statistics.
+	 */
+	void toMeta(LimaMetaFile& AMeta) const;
+	bool fromMeta(const LimaMetaFile& AMeta);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Read the statistics stored in the metadata of the file
+	 *          AFileName, without opening the file itself. Returns false if
+	 *          there are none.
+	 */
+	static bool probe(const std::string& AFileName, MeshStatistics& AStats);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Name of a cell type in the metadata.
+	 */
+	static std::string getTypeName(gmds::ECellType AType);
+
+private:
+
+	std::size_t nbNodes_;
+	std::size_t nbCells_[4];
+	std::map<gmds::ECellType,std::size_t> nbCellsPerType_;
+	std::vector<std::pair<std::string,std::size_t> > groups_[4];
+
+	double min_[3];
+	double max_[3];
+
+	/* running hashes of the coordinates and node ids, and of the
+	 * connectivities and ids of each dimension; they are kept apart so
+	 * that the checksum does not depend on how the values are chunked */
+	uint64_t coordsHash_;
+	uint64_t connectivityHash_[4];
+	uint64_t idsHash_[4];
+
+	/* chunk checksums, recorded if chunkSize_ is not 0 */
+	Lima::id_type chunkSize_;
+	std::vector<uint64_t> chunkChecksums_[4];
+
+	/* checksum read by fromMeta, the hashes are not stored */
+	uint64_t storedChecksum_;
+	bool isStored_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_MESHSTATISTICS_H_
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,138 @@
+/*----------------------------------------------------------------------------*/
+/** \file    SoAMeshView.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_SOAMESHVIEW_H_
+#define GMDS_SOAMESHVIEW_H_
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include <Lima/lima++.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Mesh view over user arrays, without any copy: coordinates as
+ *          three arrays, the cells of each dimension in CSR form and the
+ *          groups as lists of indices.
+ *
+ *          Nodes and cells are designated by their index, from 0. The cells
+ *          of dimension d are cells[d] (d = 1, 2 or 3): the nodes of cell i
+ *          are nodes[offsets[i]] to nodes[offsets[i+1]-1].
+ *
+ *          A mesh view is what LimaViewWriter writes. Any type providing the
+ *          same methods as SoAMeshView (getDim to getGroupCells) is a mesh
+ *          view, see also IGMeshView.
+ */
+struct SoAMeshView {
+
+	struct Cells {
+		std::size_t nb;
+		const std::size_t* offsets;
+		const std::size_t* nodes;
+		const gmds::ECellType* types;
+	};
+
+	struct Group {
+		std::string name;
+		std::size_t size;
+		const std::size_t* cells;
+	};
+
+	SoAMeshView()
+	:dim(3),nbNodes(0),x(0),y(0),z(0)
+	{
+		for(int d=0; d<4; d++) {
+			Cells c = {0, 0, 0, 0};
+			cells[d] = c;
+		}
+	}
+
+	/* mesh dimension */
+	int dim;
+
+	std::size_t nbNodes;
+	const double* x;
+	const double* y;
+	const double* z;
+
+	/* cells[0] is not used */
+	Cells cells[4];
+
+	/* node, edge, face and region groups */
+	std::vector<Group> groups[4];
+
+	/*------------------------------------------------------------------------*/
+	/* mesh view interface */
+
+	int getDim() const {
+		return dim;
+	}
+
+	std::size_t getNbNodes() const {
+		return nbNodes;
+	}
+
+	/* coordinates of the ANb nodes from index AFirst */
+	void getCoordinates(std::size_t AFirst, std::size_t ANb,
+			double* AX, double* AY, double* AZ) const {
+		std::copy(x+AFirst, x+AFirst+ANb, AX);
+		std::copy(y+AFirst, y+AFirst+ANb, AY);
+		if(z) {
+			std::copy(z+AFirst, z+AFirst+ANb, AZ);
+		}
+		else {
+			std::fill(AZ, AZ+ANb, 0.);
+		}
+	}
+
+	/* number of cells of dimension ADim (1, 2 or 3) */
+	std::size_t getNbCells(int ADim) const {
+		return cells[ADim].nb;
+	}
+
+	std::size_t getNbNodes(int ADim, std::size_t ACell) const {
+		return cells[ADim].offsets[ACell+1]-cells[ADim].offsets[ACell];
+	}
+
+	/* node indices of a cell */
+	void getNodes(int ADim, std::size_t ACell, Lima::id_type* ANodes) const {
+		const Cells& c = cells[ADim];
+		for(std::size_t i=c.offsets[ACell]; i<c.offsets[ACell+1]; i++) {
+			*ANodes++ = c.nodes[i];
+		}
+	}
+
+	gmds::ECellType getType(int ADim, std::size_t ACell) const {
+		return cells[ADim].types[ACell];
+	}
+
+	/* groups of dimension ADim (0 to 3) */
+	std::size_t getNbGroups(int ADim) const {
+		return groups[ADim].size();
+	}
+
+	std::string getGroupName(int ADim, std::size_t AGroup) const {
+		return groups[ADim][AGroup].name;
+	}
+
+	std::size_t getGroupSize(int ADim, std::size_t AGroup) const {
+		return groups[ADim][AGroup].size;
+	}
+
+	/* indices of the ANb cells of a group from its AFirst-th one */
+	void getGroupCells(int ADim, std::size_t AGroup, std::size_t AFirst,
+			std::size_t ANb, Lima::id_type* ACells) const {
+		const std::size_t* cells = groups[ADim][AGroup].cells;
+		std::copy(cells+AFirst, cells+AFirst+ANb, ACells);
+	}
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_SOAMESHVIEW_H_
+/*----------------------------------------------------------------------------*/
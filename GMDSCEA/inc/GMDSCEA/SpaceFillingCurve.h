@@ -0,0 +1,80 @@
+/*----------------------------------------------------------------------------*/
+/** \file    SpaceFillingCurve.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_SPACEFILLINGCURVE_H_
+#define GMDS_SPACEFILLINGCURVE_H_
+/*----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <vector>
+#include <stdint.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Order in which the nodes and cells are numbered when a mesh is
+ *          written or read.
+ */
+enum ERenumbering {
+	/* order of the mesh containers (or of the file) */
+	GMDSCEA_RENUMBER_NONE,
+	/* Morton (Z-order) curve */
+	GMDSCEA_RENUMBER_MORTON,
+	/* Hilbert curve */
+	GMDSCEA_RENUMBER_HILBERT
+};
+/*----------------------------------------------------------------------------*/
+/** \brief  Space-filling curve over a bounding box, used to sort points so
+ *          that points close in space get close positions.
+ */
+class SpaceFillingCurve{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor.
+	 *
+	 *  \param AType the curve (must not be GMDSCEA_RENUMBER_NONE)
+	 */
+	SpaceFillingCurve(ERenumbering AType);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Extend the bounding box covered by the curve with a point.
+	 *          All the points must be added before computing keys.
+	 */
+	void addToBoundingBox(double AX, double AY, double AZ);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Position of a point along the curve.
+	 */
+	uint64_t key(double AX, double AY, double AZ) const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Compute the permutation sorting AKeys by increasing value:
+	 *          AOrder[i] is the index of the i-th smallest key.
+	 */
+	static void sort(const std::vector<uint64_t>& AKeys,
+					 std::vector<std::size_t>& AOrder);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Keys of integer coordinates on a 2^21 grid per axis.
+	 */
+	static uint64_t mortonKey(uint32_t AX, uint32_t AY, uint32_t AZ);
+	static uint64_t hilbertKey(uint32_t AX, uint32_t AY, uint32_t AZ);
+
+	/* number of bits per axis */
+	static const int NB_BITS = 21;
+
+private:
+
+	ERenumbering type_;
+
+	/* bounding box */
+	double min_[3];
+	double max_[3];
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_SPACEFILLINGCURVE_H_
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,149 @@
+/*----------------------------------------------------------------------------*/
+/** \file    WriterOptions.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_WRITEROPTIONS_H_
+#define GMDS_WRITEROPTIONS_H_
+/*----------------------------------------------------------------------------*/
+#include <cstddef>
+/*----------------------------------------------------------------------------*/
+#include <Lima/lima++.h>
+#include "GMDSCEA/SpaceFillingCurve.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Precision of the node coordinates written.
+ *
+ *          Lima stores the coordinates as doubles whatever the mode, so the
+ *          readers get them back without any change; the reduced modes
+ *          round them so that their low-order mantissa bits are zero, which
+ *          the zlib compression of the datasets then removes. Without the
+ *          compression (gmdscea built without GMDSCEA_LIMA_HDF145) they
+ *          would not shrink the file, so the writers reject them.
+ */
+typedef enum {
+	/* coordinates written as they are */
+	GMDSCEA_COORD_DOUBLE,
+	/* coordinates rounded to the nearest float */
+	GMDSCEA_COORD_FLOAT,
+	/* coordinates snapped on the multiples of the largest power of two
+	 * lower than or equal to WriterOptions::tolerance */
+	GMDSCEA_COORD_QUANTIZED
+} ECoordinatePrecision;
+/*----------------------------------------------------------------------------*/
+/** \brief  Storage options of the mli2 writers (LimaWriterAPI, through
+ *          GMDSCEAWriter).
+ *
+ *          Lima creates the HDF5 file and its datasets itself and does not
+ *          let us set the HDF5 property lists, so the layout is driven by
+ *          what reaches HDF5 from here: the number of entities given to
+ *          each MaliPPWriter2 call, which is the size of each hyperslab
+ *          written, and the order and numbering of the entities.
+ */
+struct WriterOptions {
+
+	WriterOptions()
+	:chunkSize(10000),alignment(0),renumbering(GMDSCEA_RENUMBER_NONE),
+	 compact(false),compression(false),
+	 precision(GMDSCEA_COORD_DOUBLE),tolerance(0.),metadata(false),
+	 verify(false)
+	{}
+
+	/* number of entities written by each call to Lima */
+	Lima::id_type chunkSize;
+
+	/* if not 0, size in bytes (for instance the stripe size of a parallel
+	 * file system) to which each block of coordinates or ids written is
+	 * rounded: chunkSize is taken as a multiple of alignment/8 */
+	std::size_t alignment;
+
+	/* numbering of the entities in the file, see LimaWriterAPI */
+	ERenumbering renumbering;
+
+	/* renumber the ids with holes contiguously, see LimaWriterAPI::write */
+	bool compact;
+
+	/* zlib compression of the datasets, only available with the hdf145
+	 * build of Lima (GMDSCEA_LIMA_HDF145), rejected by the writers
+	 * otherwise */
+	bool compression;
+
+	/* precision of the coordinates written */
+	ECoordinatePrecision precision;
+
+	/* absolute tolerance of GMDSCEA_COORD_QUANTIZED, in mesh units; each
+	 * coordinate is moved by at most tolerance/2 */
+	double tolerance;
+
+	/* store the statistics of the mesh written (see MeshStatistics) in the
+	 * metadata file <file>.meta */
+	bool metadata;
+
+	/* store as well a checksum of each chunk written, so that LimaVerifier
+	 * can check the file; it implies metadata */
+	bool verify;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Number of entities written at once once the alignment is
+	 *          taken into account.
+	 */
+	Lima::id_type getChunkSize() const {
+		const Lima::id_type unit = alignment/sizeof(double);
+		if(unit <= 1) {
+			return chunkSize>0?chunkSize:1;
+		}
+		return chunkSize<unit?unit:(chunkSize/unit)*unit;
+	}
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Preset for a local SSD: blocks of 512KB per coordinate array.
+	 */
+	static WriterOptions localSSD() {
+		WriterOptions options;
+		options.chunkSize = 65536;
+		return options;
+	}
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Preset for preview and visualization outputs: single
+	 *          precision coordinates, or coordinates quantized with the
+	 *          absolute tolerance ATolerance if it is positive, and zlib
+	 *          compression. The files are only smaller with the compression,
+	 *          so the writers reject this preset when gmdscea is built
+	 *          without GMDSCEA_LIMA_HDF145 (see
+	 *          LimaWriterAPI::hasCompression).
+	 */
+	static WriterOptions preview(double ATolerance=0.) {
+		WriterOptions options;
+		options.compression = true;
+		if(ATolerance > 0.) {
+			options.precision = GMDSCEA_COORD_QUANTIZED;
+			options.tolerance = ATolerance;
+		}
+		else {
+			options.precision = GMDSCEA_COORD_FLOAT;
+		}
+		return options;
+	}
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Preset for a striped parallel file system (Lustre, GPFS...):
+	 *          each block written covers four full stripes of AStripeSize
+	 *          bytes, and the entities are ordered along a Hilbert curve so
+	 *          that neighbouring cells land in the same stripes.
+	 */
+	static WriterOptions stripedFileSystem(std::size_t AStripeSize=1024*1024) {
+		WriterOptions options;
+		options.alignment = AStripeSize;
+		options.chunkSize = 4*AStripeSize/sizeof(double);
+		options.renumbering = GMDSCEA_RENUMBER_HILBERT;
+		return options;
+	}
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_WRITEROPTIONS_H_
+/*----------------------------------------------------------------------------*/
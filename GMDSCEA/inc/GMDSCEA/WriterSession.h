@@ -0,0 +1,91 @@
+/*----------------------------------------------------------------------------*/
+/** \file    WriterSession.h
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GMDS_WRITERSESSION_H_
+#define GMDS_WRITERSESSION_H_
+/*----------------------------------------------------------------------------*/
+#include <string>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaWriterAPI.h"
+#include "GMDSCEA/WriterOptions.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+/** \brief  Writer of the successive states of a mesh, for instance the
+ *          outputs of a time loop.
+ *
+ *          The session keeps a single LimaWriterAPI whose chunk buffers and
+ *          renumbering arrays are allocated by the first write and reused
+ *          by the following ones, as are the options and the length unit.
+ *          Each write still opens its own Lima writer, which is bound to
+ *          one file.
+ */
+class WriterSession{
+public:
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Constructor.
+	 *
+	 *  \param AMesh  the mesh written by the session, it can be modified
+	 *  			  between two writes.
+	 *  \param AModel the part of the mesh written.
+	 */
+	WriterSession(gmds::IGMesh& AMesh, gmds::MeshModel AModel);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Destructor.	*/
+	virtual ~WriterSession();
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the storage options of the following writes, see
+	 *          LimaWriterAPI::setOptions.
+	 */
+	void setOptions(const WriterOptions& AOptions);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Set the mesh length unit of the following writes.
+	 */
+	void setLengthUnit(double AUnit);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Write the current state of the mesh into AFileName.
+	 */
+	void write(const std::string& AFileName);
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Number of files written by the session.
+	 */
+	int getNbWrites() const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Statistics of the last write.
+	 */
+	const MeshStatistics& getStatistics() const;
+
+	/*------------------------------------------------------------------------*/
+	/** \brief  Free the buffers kept between the writes, for instance before
+	 *          a memory intensive phase. The next write allocates them again.
+	 */
+	void release();
+
+protected:
+
+	/* part of the mesh written */
+	gmds::MeshModel model_;
+
+	/* writer reused by all the writes */
+	LimaWriterAPI writer_;
+
+	/* number of files written */
+	int nbWrites_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
+#endif  // GMDS_WRITERSESSION_H_
+/*----------------------------------------------------------------------------*/
@@ -6,18 +6,25 @@
 /*----------------------------------------------------------------------------*/
 #include "GMDSCEA/GMDSCEAWriter.h"
 /*----------------------------------------------------------------------------*/
+#include <cstring>
 #include <vector>
 /*----------------------------------------------------------------------------*/
+#include <sys/stat.h>
+#include <unistd.h>
+/*----------------------------------------------------------------------------*/
 #include <Lima/malipp.h>
 #include <Lima/lima++.h>
 #include <LimaP/reader.h>
 #include "GMDSCEA/LimaWriter.h"
 #include "GMDSCEA/LimaWriterAPI.h"
+#include "GMDSCEA/LimaMetaFile.h"
+#include "GMDSCEA/MeshHash.h"
 /*----------------------------------------------------------------------------*/
 namespace gmds{
 /*----------------------------------------------------------------------------*/
 GMDSCEAWriter::GMDSCEAWriter(gmds::IGMesh& AMesh)
-:mesh_(AMesh),lenghtUnit_(1.)
+:mesh_(AMesh),lenghtUnit_(1.),skipUnchanged_(false),lastSkipped_(false),
+ stager_(0)
 {
 
 }
@@ -34,8 +41,155 @@ GMDSCEAWriter::setLengthUnit(double AUnit)
 }
 /*----------------------------------------------------------------------------*/
 void
+GMDSCEAWriter::setOptions(const WriterOptions& AOptions)
+{
+	options_ = AOptions;
+}
+/*----------------------------------------------------------------------------*/
+void
+GMDSCEAWriter::setSkipUnchanged(bool ASkip)
+{
+	skipUnchanged_ = ASkip;
+}
+/*----------------------------------------------------------------------------*/
+bool
+GMDSCEAWriter::isLastWriteSkipped() const
+{
+	return lastSkipped_;
+}
+/*----------------------------------------------------------------------------*/
+void
+GMDSCEAWriter::setStaging(LimaStager* AStager)
+{
+	stager_ = AStager;
+}
+/*----------------------------------------------------------------------------*/
+const MeshStatistics&
+GMDSCEAWriter::getStatistics() const
+{
+	return stats_;
+}
+/*----------------------------------------------------------------------------*/
+std::string
+GMDSCEAWriter::computeHash(const std::string& AFileName, gmds::MeshModel AModel,
+		int ACompact) const
+{
+	MeshHash hash(mesh_);
+	uint64_t h = hash.compute(AModel);
+
+	// a file of another format cannot be a link to this one
+	h = MeshHash::combine(h,static_cast<uint64_t>(Lima::_Reader::detectFormat(AFileName)));
+
+	// the writing parameters change the file as well
+	uint64_t unit;
+	std::memcpy(&unit,&lenghtUnit_,sizeof(unit));
+	uint64_t tolerance;
+	std::memcpy(&tolerance,&options_.tolerance,sizeof(tolerance));
+	h = MeshHash::combine(h,unit);
+	h = MeshHash::combine(h,ACompact || options_.compact);
+	h = MeshHash::combine(h,options_.renumbering);
+	h = MeshHash::combine(h,options_.precision);
+	h = MeshHash::combine(h,tolerance);
+	// the metadata and the chunk checksums asked for must be in the file
+	h = MeshHash::combine(h,options_.compression);
+	h = MeshHash::combine(h,options_.metadata);
+	h = MeshHash::combine(h,options_.verify);
+	return MeshHash::toString(h);
+}
+/*----------------------------------------------------------------------------*/
+void
 GMDSCEAWriter::write(const std::string& AFileName, gmds::MeshModel AModel, int ACompact)
 {
+	lastSkipped_ = false;
+	stats_.clear();
+
+	// the files compared must be at their path
+	if(stager_) {
+		stager_->wait(AFileName);
+		stager_->wait(lastFile_);
+	}
+
+	struct stat st;
+	const bool exists = (stat(AFileName.c_str(),&st) == 0);
+
+	if(!skipUnchanged_) {
+		if(exists) {
+			LimaMetaFile::remove(AFileName);
+		}
+		const std::string target = stage(AFileName);
+		writeFile(target,AModel,ACompact);
+		unstage(target,AFileName);
+		return;
+	}
+
+	const std::string hash = computeHash(AFileName,AModel,ACompact);
+	LimaMetaFile meta;
+
+	// the file already holds this content
+	if(exists && meta.read(AFileName) && meta.get("hash") == hash) {
+		stats_.fromMeta(meta);
+		lastFile_ = AFileName;
+		lastHash_ = hash;
+		lastSkipped_ = true;
+		return;
+	}
+
+	// the previous file written holds this content
+	struct stat lastSt;
+	if(!lastFile_.empty() && lastFile_ != AFileName && lastHash_ == hash &&
+	   stat(lastFile_.c_str(),&lastSt) == 0) {
+		unlink(AFileName.c_str());
+		if(link(lastFile_.c_str(),AFileName.c_str()) == 0) {
+			// same metadata as the linked file
+			meta.read(lastFile_);
+			stats_.fromMeta(meta);
+			meta.set("hash",hash);
+			meta.set("link",lastFile_);
+			meta.write(AFileName);
+			lastFile_ = AFileName;
+			lastSkipped_ = true;
+			return;
+		}
+		// the files are not on the same file system, the mesh is written
+	}
+
+	LimaMetaFile::remove(AFileName);
+	const std::string target = stage(AFileName);
+	writeFile(target,AModel,ACompact);
+
+	// keeps the statistics written with the file, if any
+	meta.read(target);
+	meta.set("hash",hash);
+	meta.write(target);
+	unstage(target,AFileName);
+	lastFile_ = AFileName;
+	lastHash_ = hash;
+}
+/*----------------------------------------------------------------------------*/
+std::string
+GMDSCEAWriter::stage(const std::string& AFileName)
+{
+	return stager_?stager_->getStagedPath(AFileName):AFileName;
+}
+/*----------------------------------------------------------------------------*/
+void
+GMDSCEAWriter::unstage(const std::string& ATarget, const std::string& AFileName)
+{
+	if(ATarget != AFileName) {
+		stager_->migrate(ATarget,AFileName);
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+GMDSCEAWriter::writeFile(const std::string& AFileName, gmds::MeshModel AModel, int ACompact)
+{
+	// the file may be a hard link to another output: it is unlinked so
+	// that the other output is not overwritten
+	struct stat st;
+	if(stat(AFileName.c_str(),&st) == 0 && st.st_nlink > 1) {
+		unlink(AFileName.c_str());
+	}
+
 	/* Detection du format par le suffixe du nom du fichier. */
 	Lima::format_t format = Lima::SUFFIXE;
 	format = Lima::_Reader::detectFormat(AFileName);
@@ -52,7 +206,9 @@ GMDSCEAWriter::write(const std::string& AFileName, gmds::MeshModel AModel, int A
 		try {
 			gmds::LimaWriterAPI w(mesh_);
 			w.setLengthUnit(lenghtUnit_);
+			w.setOptions(options_);
 			w.write(AFileName,AModel,ACompact);
+			stats_ = w.getStatistics();
 		}
 		catch(gmds::GMDSException& e) {
 			std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
@@ -85,6 +241,10 @@ GMDSCEAWriter::write(const std::string& AFileName, gmds::MeshModel AModel, int A
 		}
 		catch(gmds::GMDSException& e) {
 			std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
+			if(stager_) {
+				// a partial staged file is not kept
+				unlink(AFileName.c_str());
+			}
 			throw GMDSException(e.what());
 		}
 	}
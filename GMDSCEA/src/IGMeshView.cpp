@@ -0,0 +1,159 @@
+/*----------------------------------------------------------------------------*/
+/** \file    IGMeshView.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/IGMeshView.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+template<typename TIterator>
+void
+collectIDs(TIterator AIt, std::vector<gmds::TCellID>& AIDs,
+		std::vector<Lima::id_type>& AIndices)
+{
+	for(;!AIt.isDone();AIt.next()) {
+		const gmds::TCellID id = AIt.value().getID();
+		if(static_cast<std::size_t>(id) >= AIndices.size()) {
+			AIndices.resize(id+1,0);
+		}
+		AIndices[id] = AIDs.size();
+		AIDs.push_back(id);
+	}
+}
+/*----------------------------------------------------------------------------*/
+template<typename TGroupIterator>
+void
+collectGroups(TGroupIterator ABegin, TGroupIterator AEnd,
+		const std::vector<Lima::id_type>& AIndices,
+		std::vector<std::string>& ANames,
+		std::vector<std::vector<Lima::id_type> >& ACells)
+{
+	for(;ABegin!=AEnd;++ABegin) {
+		ANames.push_back(ABegin->name());
+		std::vector<gmds::TCellID> ids = ABegin->cellIDs();
+		std::vector<Lima::id_type> cells(ids.size());
+		for(std::size_t i=0; i<ids.size(); i++) {
+			cells[i] = AIndices[ids[i]];
+		}
+		ACells.push_back(cells);
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+IGMeshView::IGMeshView(gmds::IGMesh& AMesh)
+:mesh_(AMesh)
+{
+	collectIDs(mesh_.nodes_begin(),  ids_[0],indices_[0]);
+	collectIDs(mesh_.edges_begin(),  ids_[1],indices_[1]);
+	collectIDs(mesh_.faces_begin(),  ids_[2],indices_[2]);
+	collectIDs(mesh_.regions_begin(),ids_[3],indices_[3]);
+
+	collectGroups(mesh_.clouds_begin(),  mesh_.clouds_end(),  indices_[0],groupsNames_[0],groupsCells_[0]);
+	collectGroups(mesh_.lines_begin(),   mesh_.lines_end(),   indices_[1],groupsNames_[1],groupsCells_[1]);
+	collectGroups(mesh_.surfaces_begin(),mesh_.surfaces_end(),indices_[2],groupsNames_[2],groupsCells_[2]);
+	collectGroups(mesh_.volumes_begin(), mesh_.volumes_end(), indices_[3],groupsNames_[3],groupsCells_[3]);
+}
+/*----------------------------------------------------------------------------*/
+IGMeshView::~IGMeshView()
+{
+
+}
+/*----------------------------------------------------------------------------*/
+int
+IGMeshView::getDim() const
+{
+	return mesh_.getDim();
+}
+/*----------------------------------------------------------------------------*/
+std::size_t
+IGMeshView::getNbNodes() const
+{
+	return ids_[0].size();
+}
+/*----------------------------------------------------------------------------*/
+void
+IGMeshView::getCoordinates(std::size_t AFirst, std::size_t ANb,
+		double* AX, double* AY, double* AZ) const
+{
+	for(std::size_t i=0; i<ANb; i++) {
+		const gmds::Node n = mesh_.get<gmds::Node>(ids_[0][AFirst+i]);
+		AX[i] = n.X();
+		AY[i] = n.Y();
+		AZ[i] = n.Z();
+	}
+}
+/*----------------------------------------------------------------------------*/
+std::size_t
+IGMeshView::getNbCells(int ADim) const
+{
+	return ids_[ADim].size();
+}
+/*----------------------------------------------------------------------------*/
+std::size_t
+IGMeshView::getNbNodes(int ADim, std::size_t ACell) const
+{
+	switch(ADim) {
+	case 1 : return 2;
+	case 2 : return mesh_.get<gmds::Face>(ids_[2][ACell]).getNbNodes();
+	default: return mesh_.get<gmds::Region>(ids_[3][ACell]).getNbNodes();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+IGMeshView::getNodes(int ADim, std::size_t ACell, Lima::id_type* ANodes) const
+{
+	switch(ADim) {
+	case 1 : mesh_.get<gmds::Edge>(ids_[1][ACell]).getAllIDs<gmds::Node>(nodesIDs_);   break;
+	case 2 : mesh_.get<gmds::Face>(ids_[2][ACell]).getAllIDs<gmds::Node>(nodesIDs_);   break;
+	default: mesh_.get<gmds::Region>(ids_[3][ACell]).getAllIDs<gmds::Node>(nodesIDs_); break;
+	}
+	for(std::size_t i=0; i<nodesIDs_.size(); i++) {
+		ANodes[i] = indices_[0][nodesIDs_[i]];
+	}
+}
+/*----------------------------------------------------------------------------*/
+gmds::ECellType
+IGMeshView::getType(int ADim, std::size_t ACell) const
+{
+	switch(ADim) {
+	case 1 : return mesh_.get<gmds::Edge>(ids_[1][ACell]).getType();
+	case 2 : return mesh_.get<gmds::Face>(ids_[2][ACell]).getType();
+	default: return mesh_.get<gmds::Region>(ids_[3][ACell]).getType();
+	}
+}
+/*----------------------------------------------------------------------------*/
+std::size_t
+IGMeshView::getNbGroups(int ADim) const
+{
+	return groupsNames_[ADim].size();
+}
+/*----------------------------------------------------------------------------*/
+std::string
+IGMeshView::getGroupName(int ADim, std::size_t AGroup) const
+{
+	return groupsNames_[ADim][AGroup];
+}
+/*----------------------------------------------------------------------------*/
+std::size_t
+IGMeshView::getGroupSize(int ADim, std::size_t AGroup) const
+{
+	return groupsCells_[ADim][AGroup].size();
+}
+/*----------------------------------------------------------------------------*/
+void
+IGMeshView::getGroupCells(int ADim, std::size_t AGroup, std::size_t AFirst,
+		std::size_t ANb, Lima::id_type* ACells) const
+{
+	const std::vector<Lima::id_type>& cells = groupsCells_[ADim][AGroup];
+	for(std::size_t i=0; i<ANb; i++) {
+		ACells[i] = cells[AFirst+i];
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,120 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaAtomicFile.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaAtomicFile.h"
+/*----------------------------------------------------------------------------*/
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+/*----------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+/* number of the temporary files created by this process */
+std::atomic<unsigned long> nbTemporaryFiles(0);
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+LimaAtomicFile::LimaAtomicFile(const std::string& AFileName)
+:fileName_(AFileName),committed_(false)
+{
+	const std::size_t slash = AFileName.rfind('/');
+	const std::string dir = (slash == std::string::npos)?"":AFileName.substr(0,slash+1);
+	const std::string base = (slash == std::string::npos)?AFileName:AFileName.substr(slash+1);
+	const std::size_t dot = base.rfind('.');
+	const std::string suffix = (dot == std::string::npos)?"":base.substr(dot);
+
+	// hidden file of the same directory, so that the rename stays on the
+	// same file system. It is created with the default permissions of a new
+	// file (0666 minus the umask), which commit keeps for a new target.
+	const unsigned long long clock =
+			std::chrono::steady_clock::now().time_since_epoch().count();
+	for(int attempt=0; ; attempt++) {
+		std::ostringstream name;
+		name<<dir<<"."<<base<<"."<<getpid()<<"."<<nbTemporaryFiles++
+			<<"."<<std::hex<<(clock & 0xffffff)<<suffix;
+		const int fd = open(name.str().c_str(),O_WRONLY|O_CREAT|O_EXCL,0666);
+		if(fd >= 0) {
+			close(fd);
+			path_ = name.str();
+			return;
+		}
+		// a file left by a process of the same pid
+		if(errno != EEXIST || attempt == 100) {
+			throw GMDSException("LimaAtomicFile unable to create "+name.str()+" : "+std::strerror(errno));
+		}
+	}
+}
+/*----------------------------------------------------------------------------*/
+LimaAtomicFile::~LimaAtomicFile()
+{
+	if(!committed_) {
+		unlink(path_.c_str());
+	}
+}
+/*----------------------------------------------------------------------------*/
+const std::string&
+LimaAtomicFile::path() const
+{
+	return path_;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaAtomicFile::commit()
+{
+	// the file replaced gives its permissions, a new file keeps the ones of
+	// the temporary file
+	struct stat st;
+	if(stat(fileName_.c_str(),&st) == 0) {
+		commit(st.st_mode & 07777);
+		return;
+	}
+	replace();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaAtomicFile::commit(mode_t AMode)
+{
+	if(chmod(path_.c_str(),AMode) != 0) {
+		throw GMDSException("LimaAtomicFile unable to set the permissions of "+path_+" : "+std::strerror(errno));
+	}
+	replace();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaAtomicFile::replace()
+{
+	// the content is on disk before the rename makes it visible, so that a
+	// crash cannot leave an empty or partial target
+	const int fd = open(path_.c_str(),O_RDONLY);
+	if(fd < 0) {
+		throw GMDSException("LimaAtomicFile unable to open "+path_+" : "+std::strerror(errno));
+	}
+	const int res = fsync(fd);
+	const int err = errno;
+	close(fd);
+	if(res != 0) {
+		throw GMDSException("LimaAtomicFile unable to sync "+path_+" : "+std::strerror(err));
+	}
+
+	if(std::rename(path_.c_str(),fileName_.c_str()) != 0) {
+		throw GMDSException("LimaAtomicFile unable to rename "+path_+" to "+fileName_+" : "+std::strerror(errno));
+	}
+	committed_ = true;
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
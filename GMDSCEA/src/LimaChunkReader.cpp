@@ -0,0 +1,203 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaChunkReader.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaChunkReader.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+/*----------------------------------------------------------------------------*/
+#include <Lima/polyedre.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+const std::size_t LimaChunkReader_MAX_NBNODES_PER_CELL = 15; //Lima::MAX_NOEUDS;
+/*----------------------------------------------------------------------------*/
+/* bytes of the buffers of one cell: id, offset, type, nodes and their
+ * coordinates */
+const std::size_t LimaChunkReader_CELL_BYTES =
+		2*sizeof(Lima::id_type)+sizeof(int)+
+		LimaChunkReader_MAX_NBNODES_PER_CELL*(sizeof(Lima::id_type)+3*sizeof(double));
+/*----------------------------------------------------------------------------*/
+/* access to the cells of a dimension of a Lima mesh */
+Lima::size_type
+nbCells(Lima::Maillage& AMesh, int ADim)
+{
+	switch(ADim) {
+	case 1 : return AMesh.nb_bras();
+	case 2 : return AMesh.nb_polygones();
+	default: return AMesh.nb_polyedres();
+	}
+}
+/*----------------------------------------------------------------------------*/
+template<typename TLimaCell>
+void
+appendCell(const TLimaCell& ACell, bool AResolve,
+		std::vector<Lima::id_type>& ANodes,
+		std::vector<double>& AX, std::vector<double>& AY, std::vector<double>& AZ)
+{
+	for(Lima::size_type k=0; k<ACell.nb_noeuds(); k++) {
+		const Lima::Noeud n = ACell.noeud(k);
+		ANodes.push_back(n.id());
+		if(AResolve) {
+			AX.push_back(n.x());
+			AY.push_back(n.y());
+			AZ.push_back(n.z());
+		}
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+LimaChunkReader::LimaChunkReader(const std::string& AFileName)
+:fileName_(AFileName),budget_(64*1024*1024),resolveCoordinates_(false),lenghtUnit_(1.)
+{
+
+}
+/*----------------------------------------------------------------------------*/
+LimaChunkReader::~LimaChunkReader()
+{
+
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkReader::setMemoryBudget(std::size_t ABytes)
+{
+	budget_ = ABytes;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkReader::setResolveCoordinates(bool AResolve)
+{
+	resolveCoordinates_ = AResolve;
+}
+/*----------------------------------------------------------------------------*/
+std::size_t
+LimaChunkReader::getChunkSize() const
+{
+	return std::max<std::size_t>(1, budget_/LimaChunkReader_CELL_BYTES);
+}
+/*----------------------------------------------------------------------------*/
+double
+LimaChunkReader::getLengthUnit() const
+{
+	return lenghtUnit_;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkReader::visit(LimaChunkVisitor& AVisitor, gmds::MeshModel AModel)
+{
+	Lima::Maillage m;
+	try {
+		m.lire(fileName_);
+	}
+	catch(...) {
+		throw GMDSException("Lima cannot read the file "+fileName_);
+	}
+	lenghtUnit_ = m.unite_longueur();
+
+	if(AModel.has(N)) {
+		visitNodes(m,AVisitor);
+	}
+	if(AModel.has(E)) {
+		visitCells(m,1,AVisitor);
+	}
+	if(AModel.has(F)) {
+		visitCells(m,2,AVisitor);
+	}
+	if(AModel.has(R)) {
+		visitCells(m,3,AVisitor);
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkReader::visitNodes(Lima::Maillage& AMesh, LimaChunkVisitor& AVisitor)
+{
+	// a node only needs its id and coordinates
+	const std::size_t chunkSize = std::max<std::size_t>(1,
+			budget_/(sizeof(Lima::id_type)+3*sizeof(double)));
+	const Lima::size_type nb = AMesh.nb_noeuds();
+
+	std::vector<Lima::id_type> ids(std::min<std::size_t>(chunkSize,nb));
+	std::vector<double> x(ids.size()), y(ids.size()), z(ids.size());
+
+	for(Lima::size_type start=0; start<nb; start+=chunkSize) {
+		const std::size_t size = std::min<std::size_t>(chunkSize, nb-start);
+		for(std::size_t i=0; i<size; i++) {
+			const Lima::Noeud n = AMesh.noeud(start+i);
+			ids[i] = n.id();
+			x[i] = n.x();
+			y[i] = n.y();
+			z[i] = n.z();
+		}
+		LimaNodeChunk chunk = {size, &ids[0], &x[0], &y[0], &z[0]};
+		AVisitor.visitNodes(chunk);
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkReader::visitCells(Lima::Maillage& AMesh, int ADim, LimaChunkVisitor& AVisitor)
+{
+	const std::size_t chunkSize = getChunkSize();
+	const Lima::size_type nb = nbCells(AMesh,ADim);
+
+	std::vector<Lima::id_type> ids, offsets, nodes;
+	std::vector<int> types;
+	std::vector<double> x, y, z;
+	ids.reserve(std::min<std::size_t>(chunkSize,nb));
+	offsets.reserve(ids.capacity()+1);
+	types.reserve(ids.capacity());
+
+	for(Lima::size_type start=0; start<nb; start+=chunkSize) {
+		const std::size_t size = std::min<std::size_t>(chunkSize, nb-start);
+		ids.clear();
+		offsets.clear();
+		nodes.clear();
+		types.clear();
+		x.clear();
+		y.clear();
+		z.clear();
+
+		offsets.push_back(0);
+		for(std::size_t i=0; i<size; i++) {
+			switch(ADim) {
+			case 1 : {
+				const Lima::Bras b = AMesh.bras(start+i);
+				ids.push_back(b.id());
+				types.push_back(2);
+				appendCell(b,resolveCoordinates_,nodes,x,y,z);
+				break;
+			}
+			case 2 : {
+				const Lima::Polygone p = AMesh.polygone(start+i);
+				ids.push_back(p.id());
+				types.push_back(p.nb_noeuds());
+				appendCell(p,resolveCoordinates_,nodes,x,y,z);
+				break;
+			}
+			default : {
+				const Lima::Polyedre p = AMesh.polyedre(start+i);
+				ids.push_back(p.id());
+				types.push_back(p.type());
+				appendCell(p,resolveCoordinates_,nodes,x,y,z);
+				break;
+			}
+			}
+			offsets.push_back(nodes.size());
+		}
+
+		LimaCellChunk chunk = {size, &ids[0], &offsets[0], nodes.empty()?0:&nodes[0], &types[0],
+				resolveCoordinates_?&x[0]:0, resolveCoordinates_?&y[0]:0, resolveCoordinates_?&z[0]:0};
+		switch(ADim) {
+		case 1 : AVisitor.visitEdges(chunk);   break;
+		case 2 : AVisitor.visitFaces(chunk);   break;
+		default: AVisitor.visitRegions(chunk); break;
+		}
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
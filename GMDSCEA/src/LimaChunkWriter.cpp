@@ -0,0 +1,339 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaChunkWriter.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaChunkWriter.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <iostream>
+/*----------------------------------------------------------------------------*/
+#include <Lima/erreur.h>
+#include <Lima/polyedre.h>
+#include "GMDSCEA/LimaAtomicFile.h"
+#include "GMDSCEA/LimaWriterAPI.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+/* ABuffer holds at least ASize values, it is only grown so that its memory
+ * is reused by the following writes */
+template<typename T>
+void
+grow(std::vector<T>& ABuffer, const std::size_t ASize)
+{
+	if(ABuffer.size() < ASize) {
+		ABuffer.resize(ASize);
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+LimaChunkWriter::LimaChunkWriter()
+:chunkSize_(WriterOptions().chunkSize),
+ precision_(GMDSCEA_COORD_DOUBLE),tolerance_(0.),compression_(false),
+ metadata_(false),verify_(false),
+ dim_(0),maxNbNodes_(0),capacity_(0),count_(0),index_(0)
+{}
+/*----------------------------------------------------------------------------*/
+LimaChunkWriter::~LimaChunkWriter()
+{}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::setOptions(const WriterOptions& AOptions)
+{
+	// nothing is changed when the options are rejected
+	LimaWriterAPI::checkOptions(AOptions);
+
+	chunkSize_ = AOptions.getChunkSize();
+	precision_ = AOptions.precision;
+	tolerance_ = AOptions.tolerance;
+	compression_ = AOptions.compression;
+	metadata_ = AOptions.metadata || AOptions.verify;
+	verify_ = AOptions.verify;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::setChunkSize(Lima::id_type AChunkSize)
+{
+	chunkSize_ = AChunkSize;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::setCompression(bool ACompression)
+{
+	compression_ = ACompression;
+}
+/*----------------------------------------------------------------------------*/
+const MeshStatistics&
+LimaChunkWriter::getStatistics() const
+{
+	return stats_;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::releaseBuffers()
+{
+	buffers_ = ChunkBuffers();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::write(const std::string& AFileName, int ADim, double ALengthUnit,
+		const std::function<void()>& AContent, const std::string& ACaller)
+{
+	stats_.clear();
+	if(verify_) {
+		stats_.setChunkChecksums(chunkSize_);
+	}
+
+	// the mesh is written in a temporary file that replaces AFileName only
+	// once complete, a failure leaves the previous file untouched
+	LimaAtomicFile file(AFileName);
+
+	try {
+		writer_.reset(new Lima::MaliPPWriter2(file.path(), 1));
+		LimaWriterAPI::setCompression(*writer_,compression_);
+
+		writer_->unite_longueur(ALengthUnit);
+		Lima::dim_t dim;
+		if(ADim == 3) {
+			dim = Lima::D3;
+		} else if(ADim == 2) {
+			dim = Lima::D2;
+		} else {
+			dim = Lima::D1;
+		}
+		writer_->dimension(dim);
+
+		writer_->beginWrite();
+
+		AContent();
+
+		writer_->writeNodeAttributes();
+		writer_->writeEdgeAttributes();
+		writer_->writeFaceAttributes();
+		writer_->writeRegionAttributes();
+
+		writer_->writeNodeSetsAttributes();
+		writer_->writeEdgeSetsAttributes();
+		writer_->writeFaceSetsAttributes();
+		writer_->writeRegionSetsAttributes();
+
+		writer_->close ( );
+		writer_.reset();
+	}
+	catch(Lima::write_erreur& e) {
+		writer_.reset();
+		std::cerr<<"GMDSCEA ERREUR "<<ACaller<<" : "<<e.what()<<std::endl;
+		throw GMDSException(e.what());
+	}
+	catch(...) {
+		writer_.reset();
+		throw;
+	}
+
+	file.commit();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::writeMetaFile(const std::string& AFileName, LimaMetaFile& AMeta,
+		bool ANeeded) const
+{
+	if(metadata_) {
+		stats_.toMeta(AMeta);
+	}
+	if(metadata_ || ANeeded) {
+		AMeta.write(AFileName);
+	}
+	else {
+		LimaMetaFile::remove(AFileName);
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::beginNodes(Lima::id_type ANb, bool AContiguous, Lima::id_type AFirst)
+{
+	writer_->writeNodesInfo(AContiguous,ANb,AFirst);
+
+	dim_ = 0;
+	capacity_ = std::max<Lima::id_type>(std::min(chunkSize_,ANb),1);
+	count_ = 0;
+	grow(buffers_.x,capacity_);
+	grow(buffers_.y,capacity_);
+	grow(buffers_.z,capacity_);
+	grow(buffers_.ids,capacity_);
+}
+/*----------------------------------------------------------------------------*/
+Lima::id_type
+LimaChunkWriter::getNodeChunk(double*& AX, double*& AY, double*& AZ, Lima::id_type*& AIDs)
+{
+	if(count_ == capacity_) {
+		flushNodes();
+	}
+	AX = &buffers_.x[count_];
+	AY = &buffers_.y[count_];
+	AZ = &buffers_.z[count_];
+	AIDs = &buffers_.ids[count_];
+	return capacity_-count_;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::endNodes()
+{
+	flushNodes();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::flushNodes()
+{
+	if(count_ == 0) {
+		return;
+	}
+
+	double* xcoords = &buffers_.x[0];
+	double* ycoords = &buffers_.y[0];
+	double* zcoords = &buffers_.z[0];
+	if(precision_ != GMDSCEA_COORD_DOUBLE) {
+		const double step = (precision_ == GMDSCEA_COORD_QUANTIZED)?
+				LimaWriterAPI::getQuantizationStep(tolerance_):0.;
+		for(Lima::id_type i=0; i<count_; i++) {
+			xcoords[i] = LimaWriterAPI::roundCoordinate(xcoords[i],precision_,step);
+			ycoords[i] = LimaWriterAPI::roundCoordinate(ycoords[i],precision_,step);
+			zcoords[i] = LimaWriterAPI::roundCoordinate(zcoords[i],precision_,step);
+		}
+	}
+
+	stats_.addNodes(count_,xcoords,ycoords,zcoords,&buffers_.ids[0]);
+	writer_->writeNodes(count_,xcoords,ycoords,zcoords,&buffers_.ids[0]);
+	count_ = 0;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::beginCells(int ADim, Lima::id_type ANb, bool AContiguous, Lima::id_type AFirst,
+		Lima::id_type AMaxNbNodes)
+{
+	switch(ADim) {
+	case 1 : writer_->writeEdgesInfo(AContiguous,ANb,AFirst);   break;
+	case 2 : writer_->writeFacesInfo(AContiguous,ANb,AFirst);   break;
+	default: writer_->writeRegionsInfo(AContiguous,ANb,AFirst); break;
+	}
+	if(ADim == 1 && ANb > 0) {
+		stats_.addCellType(GMDS_EDGE,ANb);
+	}
+
+	dim_ = ADim;
+	maxNbNodes_ = AMaxNbNodes;
+	capacity_ = std::max<Lima::id_type>(std::min(chunkSize_,ANb),1);
+	count_ = 0;
+	index_ = 0;
+	grow(buffers_.connectivity,maxNbNodes_*capacity_);
+	grow(buffers_.nbNodes,capacity_);
+	grow(buffers_.types,capacity_);
+	grow(buffers_.ids,capacity_);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::endCells()
+{
+	flushCells();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::flushCells()
+{
+	if(count_ == 0) {
+		return;
+	}
+
+	Lima::id_type* cell2nodeIDs = &buffers_.connectivity[0];
+	Lima::id_type* ids = &buffers_.ids[0];
+	stats_.addCells(dim_,count_,cell2nodeIDs,index_,ids);
+	switch(dim_) {
+	case 1 : writer_->writeEdges(count_,cell2nodeIDs,ids);                          break;
+	case 2 : writer_->writeFaces(count_,cell2nodeIDs,&buffers_.nbNodes[0],ids);     break;
+	default: writer_->writeRegions(count_,cell2nodeIDs,&buffers_.types[0],ids);     break;
+	}
+	count_ = 0;
+	index_ = 0;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::throwTooManyNodes() const
+{
+	throw GMDSException("LimaChunkWriter::addCell a cell has too many nodes (> 15 == Lima::MAX_NOEUDS).");
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::beginGroups(int ADim, std::vector<std::string>& ANames,
+		std::vector<Lima::id_type>& ASizes)
+{
+	for(std::size_t iGroup=0; iGroup<ANames.size(); iGroup++) {
+		stats_.addGroup(ADim,ANames[iGroup],ASizes[iGroup]);
+	}
+	switch(ADim) {
+	case 0 : writer_->writeNodeSetInfo(ANames.size(),ANames,ASizes);   break;
+	case 1 : writer_->writeEdgeSetInfo(ANames.size(),ANames,ASizes);   break;
+	case 2 : writer_->writeFaceSetInfo(ANames.size(),ANames,ASizes);   break;
+	default: writer_->writeRegionSetInfo(ANames.size(),ANames,ASizes); break;
+	}
+
+	Lima::id_type maxSize = 1;
+	for(std::size_t iGroup=0; iGroup<ASizes.size(); iGroup++) {
+		maxSize = std::max(maxSize,std::min(chunkSize_,ASizes[iGroup]));
+	}
+
+	dim_ = ADim;
+	capacity_ = maxSize;
+	count_ = 0;
+	grow(buffers_.ids,capacity_);
+	grow(buffers_.nbNodes,capacity_);
+	grow(buffers_.types,capacity_);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::beginGroup(const std::string& AName)
+{
+	group_ = AName;
+	count_ = 0;
+}
+/*----------------------------------------------------------------------------*/
+Lima::id_type
+LimaChunkWriter::getGroupChunk(Lima::id_type*& AIDs, Lima::id_type*& ANbNodes,
+		Lima::Polyedre::PolyedreType*& ATypes)
+{
+	if(count_ == capacity_) {
+		flushGroup();
+	}
+	AIDs = &buffers_.ids[count_];
+	ANbNodes = &buffers_.nbNodes[count_];
+	ATypes = &buffers_.types[count_];
+	return capacity_-count_;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::endGroup()
+{
+	flushGroup();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaChunkWriter::flushGroup()
+{
+	if(count_ == 0) {
+		return;
+	}
+
+	Lima::id_type* ids = &buffers_.ids[0];
+	switch(dim_) {
+	case 0 : writer_->writeNodeSetData(group_,count_,ids);                          break;
+	case 1 : writer_->writeEdgeSetData(group_,count_,ids);                          break;
+	case 2 : writer_->writeFaceSetData(group_,count_,ids,&buffers_.nbNodes[0]);     break;
+	default: writer_->writeRegionSetData(group_,count_,ids,&buffers_.types[0]);     break;
+	}
+	count_ = 0;
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
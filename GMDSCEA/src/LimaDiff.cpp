@@ -0,0 +1,420 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaDiff.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaDiff.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaFlatReader.h"
+#include "GMDSCEA/MeshStatistics.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+const char* dimNames[] = {"node", "edge", "face", "region"};
+const char* groupNames[] = {"cloud", "line", "surface", "volume"};
+/*----------------------------------------------------------------------------*/
+/* file id of the entity AIndex of dimension ADim */
+Lima::id_type fileID(const FlatMesh& AMesh, int ADim, std::size_t AIndex)
+{
+	return ADim==0?AMesh.nodeIDs[AIndex]:AMesh.cells[ADim].ids[AIndex];
+}
+/*----------------------------------------------------------------------------*/
+std::size_t nbEntities(const FlatMesh& AMesh, int ADim)
+{
+	return ADim==0?AMesh.x.size():AMesh.getNbCells(ADim);
+}
+/*----------------------------------------------------------------------------*/
+void readFile(const std::string& AFileName, FlatMesh& AMesh, std::string& AError)
+{
+	try {
+		LimaFlatReader reader(AMesh);
+		reader.read(AFileName,N|E|F|R);
+	}
+	catch(GMDSException& e) {
+		AError = e.what();
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+LimaDiff::LimaDiff()
+:tolerance_(0.),maxDifferences_(10),nbThreads_(0)
+{
+	for(int c=0; c<GMDSCEA_DIFF_NB_CATEGORIES; c++) {
+		nbDifferences_[c] = 0;
+	}
+}
+/*----------------------------------------------------------------------------*/
+LimaDiff::~LimaDiff()
+{
+
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaDiff::setTolerance(double ATolerance)
+{
+	tolerance_ = ATolerance;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaDiff::setMaxDifferences(std::size_t AMax)
+{
+	maxDifferences_ = AMax;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaDiff::setNbThreads(int ANbThreads)
+{
+	nbThreads_ = ANbThreads;
+}
+/*----------------------------------------------------------------------------*/
+const std::vector<LimaDifference>&
+LimaDiff::getDifferences() const
+{
+	return sorted_;
+}
+/*----------------------------------------------------------------------------*/
+std::size_t
+LimaDiff::getNbDifferences(EDiffCategory ACategory) const
+{
+	return nbDifferences_[ACategory];
+}
+/*----------------------------------------------------------------------------*/
+const char*
+LimaDiff::getCategoryName(EDiffCategory ACategory)
+{
+	switch(ACategory) {
+	case GMDSCEA_DIFF_COUNT :
+		return "count";
+	case GMDSCEA_DIFF_ID :
+		return "id";
+	case GMDSCEA_DIFF_COORDINATES :
+		return "coordinates";
+	case GMDSCEA_DIFF_CONNECTIVITY :
+		return "connectivity";
+	case GMDSCEA_DIFF_TYPE :
+		return "type";
+	case GMDSCEA_DIFF_GROUP :
+		return "group";
+	default :
+		return "unknown";
+	}
+}
+/*----------------------------------------------------------------------------*/
+bool
+LimaDiff::compare(const std::string& AFileName1, const std::string& AFileName2)
+{
+	FlatMesh mesh1, mesh2;
+	std::string error1, error2;
+#ifdef GMDSCEA_HDF5_THREADSAFE
+	std::thread reader1(readFile,std::cref(AFileName1),std::ref(mesh1),std::ref(error1));
+	readFile(AFileName2,mesh2,error2);
+	reader1.join();
+#else
+	// HDF5 is not thread-safe, the files are read one after the other
+	readFile(AFileName1,mesh1,error1);
+	readFile(AFileName2,mesh2,error2);
+#endif
+	if(!error1.empty()) {
+		throw GMDSException("LimaDiff::compare cannot read "+AFileName1+" : "+error1);
+	}
+	if(!error2.empty()) {
+		throw GMDSException("LimaDiff::compare cannot read "+AFileName2+" : "+error2);
+	}
+	return compare(mesh1,mesh2);
+}
+/*----------------------------------------------------------------------------*/
+bool
+LimaDiff::compare(const FlatMesh& AMesh1, const FlatMesh& AMesh2)
+{
+	for(int c=0; c<GMDSCEA_DIFF_NB_CATEGORIES; c++) {
+		differences_[c].clear();
+		nbDifferences_[c] = 0;
+	}
+	sorted_.clear();
+
+	compareCounts(AMesh1,AMesh2);
+	compareNodes(AMesh1,AMesh2);
+	for(int d=1; d<4; d++) {
+		compareCells(d,AMesh1,AMesh2);
+	}
+	for(int d=0; d<4; d++) {
+		compareGroups(d,AMesh1,AMesh2);
+	}
+
+	bool identical = true;
+	for(int c=0; c<GMDSCEA_DIFF_NB_CATEGORIES; c++) {
+		sorted_.insert(sorted_.end(),differences_[c].begin(),differences_[c].end());
+		identical = identical && (nbDifferences_[c] == 0);
+	}
+	return identical;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaDiff::add(Chunk& AChunk, EDiffCategory ACategory, int ADim,
+		std::size_t AIndex, const std::string& AMessage) const
+{
+	if(AChunk.nbDifferences[ACategory]++ < maxDifferences_) {
+		LimaDifference d = {ACategory, ADim, AIndex, AMessage};
+		AChunk.differences.push_back(d);
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaDiff::merge(const Chunk& AChunk)
+{
+	for(std::size_t i=0; i<AChunk.differences.size(); i++) {
+		const LimaDifference& d = AChunk.differences[i];
+		if(differences_[d.category].size() < maxDifferences_) {
+			differences_[d.category].push_back(d);
+		}
+	}
+	for(int k=0; k<GMDSCEA_DIFF_NB_CATEGORIES; k++) {
+		nbDifferences_[k] += AChunk.nbDifferences[k];
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaDiff::forChunks(std::size_t ANb, std::size_t AChunkSize,
+		const std::function<void(std::size_t, std::size_t, Chunk&)>& ACompare)
+{
+	const std::size_t nbChunks = (ANb+AChunkSize-1)/AChunkSize;
+
+	int nbThreads = nbThreads_;
+	if(nbThreads <= 0) {
+		nbThreads = std::thread::hardware_concurrency();
+	}
+	if(nbThreads <= 0) {
+		nbThreads = 1;
+	}
+	if(static_cast<std::size_t>(nbThreads) > nbChunks) {
+		nbThreads = nbChunks;
+	}
+
+	// the chunks are merged in order, so that the first differences are
+	// kept, as soon as the previous ones are; a chunk is only started
+	// within window chunks of the first one not merged, which bounds the
+	// chunks held
+	const std::size_t window = 2*nbThreads;
+	std::map<std::size_t, Chunk> compared;
+	std::size_t next = 0;
+	std::size_t nbMerged = 0;
+	std::mutex mutex;
+	std::condition_variable cond;
+
+	std::vector<std::thread> threads;
+	for(int t=0; t<nbThreads; t++) {
+		threads.push_back(std::thread([&]() {
+			for(;;) {
+				std::size_t c;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					cond.wait(lock, [&]() {
+						return next>=nbChunks || next<nbMerged+window;
+					});
+					if(next >= nbChunks) {
+						return;
+					}
+					c = next++;
+				}
+
+				Chunk chunk;
+				std::fill(chunk.nbDifferences,chunk.nbDifferences+GMDSCEA_DIFF_NB_CATEGORIES,0);
+				ACompare(c*AChunkSize,std::min((c+1)*AChunkSize,ANb),chunk);
+
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					std::swap(compared[c],chunk);
+					std::map<std::size_t, Chunk>::iterator it = compared.find(nbMerged);
+					while(it != compared.end()) {
+						merge(it->second);
+						compared.erase(it);
+						nbMerged++;
+						it = compared.find(nbMerged);
+					}
+				}
+				cond.notify_all();
+			}
+		}));
+	}
+	for(std::size_t t=0; t<threads.size(); t++) {
+		threads[t].join();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaDiff::compareCounts(const FlatMesh& AMesh1, const FlatMesh& AMesh2)
+{
+	Chunk chunk;
+	std::fill(chunk.nbDifferences,chunk.nbDifferences+GMDSCEA_DIFF_NB_CATEGORIES,0);
+
+	if(AMesh1.dim != AMesh2.dim) {
+		std::ostringstream s;
+		s<<"dimension "<<AMesh1.dim<<" != "<<AMesh2.dim;
+		add(chunk,GMDSCEA_DIFF_COUNT,0,0,s.str());
+	}
+	for(int d=0; d<4; d++) {
+		const std::size_t nb1 = nbEntities(AMesh1,d);
+		const std::size_t nb2 = nbEntities(AMesh2,d);
+		if(nb1 != nb2) {
+			std::ostringstream s;
+			s<<"number of "<<dimNames[d]<<"s "<<nb1<<" != "<<nb2;
+			add(chunk,GMDSCEA_DIFF_COUNT,d,0,s.str());
+		}
+		const std::size_t nbGroups1 = AMesh1.groups[d].names.size();
+		const std::size_t nbGroups2 = AMesh2.groups[d].names.size();
+		if(nbGroups1 != nbGroups2) {
+			std::ostringstream s;
+			s<<"number of "<<groupNames[d]<<"s "<<nbGroups1<<" != "<<nbGroups2;
+			add(chunk,GMDSCEA_DIFF_COUNT,d,0,s.str());
+		}
+	}
+
+	merge(chunk);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaDiff::compareNodes(const FlatMesh& AMesh1, const FlatMesh& AMesh2)
+{
+	const std::size_t nb = std::min(AMesh1.x.size(),AMesh2.x.size());
+	const double tol = tolerance_;
+
+	forChunks(nb,CHUNK_SIZE,[&](std::size_t AFirst, std::size_t ALast, Chunk& AChunk) {
+		for(std::size_t i=AFirst; i<ALast; i++) {
+			if(AMesh1.nodeIDs[i] != AMesh2.nodeIDs[i]) {
+				std::ostringstream s;
+				s<<"node "<<i<<": id "<<AMesh1.nodeIDs[i]<<" != "<<AMesh2.nodeIDs[i];
+				add(AChunk,GMDSCEA_DIFF_ID,0,i,s.str());
+			}
+			// written so that a NaN is a difference
+			if(!(std::fabs(AMesh1.x[i]-AMesh2.x[i]) <= tol) ||
+			   !(std::fabs(AMesh1.y[i]-AMesh2.y[i]) <= tol) ||
+			   !(std::fabs(AMesh1.z[i]-AMesh2.z[i]) <= tol)) {
+				std::ostringstream s;
+				s.precision(17);
+				s<<"node "<<i<<" (id "<<AMesh1.nodeIDs[i]<<"): ("
+				 <<AMesh1.x[i]<<", "<<AMesh1.y[i]<<", "<<AMesh1.z[i]<<") != ("
+				 <<AMesh2.x[i]<<", "<<AMesh2.y[i]<<", "<<AMesh2.z[i]<<")";
+				add(AChunk,GMDSCEA_DIFF_COORDINATES,0,i,s.str());
+			}
+		}
+	});
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaDiff::compareCells(int ADim, const FlatMesh& AMesh1, const FlatMesh& AMesh2)
+{
+	const FlatMesh::Cells& cells1 = AMesh1.cells[ADim];
+	const FlatMesh::Cells& cells2 = AMesh2.cells[ADim];
+	const std::size_t nb = std::min(AMesh1.getNbCells(ADim),AMesh2.getNbCells(ADim));
+
+	forChunks(nb,CHUNK_SIZE,[&](std::size_t AFirst, std::size_t ALast, Chunk& AChunk) {
+		for(std::size_t i=AFirst; i<ALast; i++) {
+			if(cells1.ids[i] != cells2.ids[i]) {
+				std::ostringstream s;
+				s<<dimNames[ADim]<<" "<<i<<": id "<<cells1.ids[i]<<" != "<<cells2.ids[i];
+				add(AChunk,GMDSCEA_DIFF_ID,ADim,i,s.str());
+			}
+			if(cells1.types[i] != cells2.types[i]) {
+				std::ostringstream s;
+				s<<dimNames[ADim]<<" "<<i<<" (id "<<cells1.ids[i]<<"): type "
+				 <<MeshStatistics::getTypeName(cells1.types[i])<<" != "
+				 <<MeshStatistics::getTypeName(cells2.types[i]);
+				add(AChunk,GMDSCEA_DIFF_TYPE,ADim,i,s.str());
+			}
+
+			// the nodes are compared by file id
+			const std::size_t nbNodes1 = cells1.offsets[i+1]-cells1.offsets[i];
+			const std::size_t nbNodes2 = cells2.offsets[i+1]-cells2.offsets[i];
+			bool same = (nbNodes1 == nbNodes2);
+			for(std::size_t k=0; same && k<nbNodes1; k++) {
+				same = (AMesh1.nodeIDs[cells1.nodes[cells1.offsets[i]+k]] ==
+						AMesh2.nodeIDs[cells2.nodes[cells2.offsets[i]+k]]);
+			}
+			if(!same) {
+				std::ostringstream s;
+				s<<dimNames[ADim]<<" "<<i<<" (id "<<cells1.ids[i]<<"): nodes (";
+				for(std::size_t k=0; k<nbNodes1; k++) {
+					s<<(k>0?" ":"")<<AMesh1.nodeIDs[cells1.nodes[cells1.offsets[i]+k]];
+				}
+				s<<") != (";
+				for(std::size_t k=0; k<nbNodes2; k++) {
+					s<<(k>0?" ":"")<<AMesh2.nodeIDs[cells2.nodes[cells2.offsets[i]+k]];
+				}
+				s<<")";
+				add(AChunk,GMDSCEA_DIFF_CONNECTIVITY,ADim,i,s.str());
+			}
+		}
+	});
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaDiff::compareGroups(int ADim, const FlatMesh& AMesh1, const FlatMesh& AMesh2)
+{
+	const FlatMesh::Groups& groups1 = AMesh1.groups[ADim];
+	const FlatMesh::Groups& groups2 = AMesh2.groups[ADim];
+
+	std::map<std::string,std::size_t> index2;
+	for(std::size_t g=0; g<groups2.names.size(); g++) {
+		index2[groups2.names[g]] = g;
+	}
+	std::map<std::string,std::size_t> index1;
+	for(std::size_t g=0; g<groups1.names.size(); g++) {
+		index1[groups1.names[g]] = g;
+	}
+
+	// one task per group of the first mesh
+	forChunks(groups1.names.size(),1,[&](std::size_t AFirst, std::size_t /*ALast*/, Chunk& AChunk) {
+		const std::size_t g1 = AFirst;
+		const std::string& name = groups1.names[g1];
+		std::map<std::string,std::size_t>::const_iterator it = index2.find(name);
+		if(it == index2.end()) {
+			add(AChunk,GMDSCEA_DIFF_GROUP,ADim,g1,
+					std::string(groupNames[ADim])+" "+name+" only in the first mesh");
+			return;
+		}
+		const std::size_t g2 = it->second;
+		const std::size_t size1 = groups1.offsets[g1+1]-groups1.offsets[g1];
+		const std::size_t size2 = groups2.offsets[g2+1]-groups2.offsets[g2];
+		if(size1 != size2) {
+			std::ostringstream s;
+			s<<groupNames[ADim]<<" "<<name<<": size "<<size1<<" != "<<size2;
+			add(AChunk,GMDSCEA_DIFF_GROUP,ADim,g1,s.str());
+			return;
+		}
+		for(std::size_t k=0; k<size1; k++) {
+			const Lima::id_type id1 = fileID(AMesh1,ADim,groups1.cells[groups1.offsets[g1]+k]);
+			const Lima::id_type id2 = fileID(AMesh2,ADim,groups2.cells[groups2.offsets[g2]+k]);
+			if(id1 != id2) {
+				std::ostringstream s;
+				s<<groupNames[ADim]<<" "<<name<<": member "<<k<<" "<<id1<<" != "<<id2;
+				add(AChunk,GMDSCEA_DIFF_GROUP,ADim,g1,s.str());
+				return;
+			}
+		}
+	});
+
+	Chunk chunk;
+	std::fill(chunk.nbDifferences,chunk.nbDifferences+GMDSCEA_DIFF_NB_CATEGORIES,0);
+	for(std::size_t g=0; g<groups2.names.size(); g++) {
+		if(index1.find(groups2.names[g]) == index1.end()) {
+			add(chunk,GMDSCEA_DIFF_GROUP,ADim,g,
+					std::string(groupNames[ADim])+" "+groups2.names[g]+" only in the second mesh");
+		}
+	}
+	merge(chunk);
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
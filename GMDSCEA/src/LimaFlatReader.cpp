@@ -0,0 +1,232 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaFlatReader.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaFlatReader.h"
+/*----------------------------------------------------------------------------*/
+#include <Lima/polyedre.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+LimaFlatReader::LimaFlatReader(FlatMesh& AMesh)
+:mesh_(AMesh)
+{
+
+}
+/*----------------------------------------------------------------------------*/
+LimaFlatReader::~LimaFlatReader()
+{
+
+}
+/*----------------------------------------------------------------------------*/
+gmds::ECellType
+LimaFlatReader::getRegionType(const Lima::Polyedre::PolyedreType AType)
+{
+	switch(AType) {
+	case Lima::Polyedre::TETRAEDRE :
+		return gmds::GMDS_TETRA;
+	case Lima::Polyedre::PYRAMIDE :
+		return gmds::GMDS_PYRAMID;
+	case Lima::Polyedre::PRISME :
+		return gmds::GMDS_PRISM3;
+	case Lima::Polyedre::HEXAEDRE :
+		return gmds::GMDS_HEX;
+	case Lima::Polyedre::HEPTAEDRE :
+		return gmds::GMDS_PRISM5;
+	case Lima::Polyedre::OCTOEDRE :
+		return gmds::GMDS_PRISM6;
+	default:
+		throw GMDSException("LimaFlatReader::getRegionType unknown Lima polyhedron.");
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaFlatReader::read(const std::string& AFileName, gmds::MeshModel AModel)
+{
+	Lima::Maillage m;
+	try {
+		m.lire(AFileName);
+	}
+	catch(...) {
+		throw GMDSException("Lima cannot read the file "+AFileName);
+	}
+
+	mesh_.clear();
+	mesh_.lengthUnit = m.unite_longueur();
+	switch(m.dimension()) {
+	case Lima::D1 : mesh_.dim = 1; break;
+	case Lima::D2 : mesh_.dim = 2; break;
+	default       : mesh_.dim = 3; break;
+	}
+
+	readNodes(m);
+	if(AModel.has(E)) {
+		readEdges(m);
+	}
+	if(AModel.has(F)) {
+		readFaces(m);
+	}
+	if(AModel.has(R)) {
+		readRegions(m);
+	}
+	readGroups(m,AModel);
+
+	nodesIndex_.clear();
+	for(int dim=0; dim<4; dim++) {
+		cellsIndex_[dim].clear();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaFlatReader::readNodes(Lima::Maillage& ALimaMesh)
+{
+	const std::size_t nb = ALimaMesh.nb_noeuds();
+	mesh_.x.resize(nb);
+	mesh_.y.resize(nb);
+	mesh_.z.resize(nb);
+	mesh_.nodeIDs.resize(nb);
+
+	for(std::size_t i=0; i<nb; i++) {
+		const Lima::Noeud n = ALimaMesh.noeud(i);
+		mesh_.x[i] = n.x();
+		mesh_.y[i] = n.y();
+		mesh_.z[i] = n.z();
+		mesh_.nodeIDs[i] = n.id();
+	}
+
+	nodesIndex_.build(mesh_.nodeIDs);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaFlatReader::readEdges(Lima::Maillage& ALimaMesh)
+{
+	FlatMesh::Cells& cells = mesh_.cells[1];
+	const std::size_t nb = ALimaMesh.nb_bras();
+	cells.offsets.resize(nb+1);
+	cells.nodes.resize(2*nb);
+	cells.types.assign(nb,gmds::GMDS_EDGE);
+	cells.ids.resize(nb);
+
+	cells.offsets[0] = 0;
+	for(std::size_t i=0; i<nb; i++) {
+		const Lima::Bras b = ALimaMesh.bras(i);
+		cells.nodes[2*i  ] = nodesIndex_(b.noeud(0).id());
+		cells.nodes[2*i+1] = nodesIndex_(b.noeud(1).id());
+		cells.offsets[i+1] = 2*(i+1);
+		cells.ids[i] = b.id();
+	}
+
+	cellsIndex_[1].build(cells.ids);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaFlatReader::readFaces(Lima::Maillage& ALimaMesh)
+{
+	FlatMesh::Cells& cells = mesh_.cells[2];
+	const std::size_t nb = ALimaMesh.nb_polygones();
+	cells.offsets.resize(nb+1);
+	cells.types.resize(nb);
+	cells.ids.resize(nb);
+
+	cells.offsets[0] = 0;
+	for(std::size_t i=0; i<nb; i++) {
+		const Lima::Polygone p = ALimaMesh.polygone(i);
+		const std::size_t nbNodes = p.nb_noeuds();
+		cells.offsets[i+1] = cells.offsets[i]+nbNodes;
+		cells.types[i] = (nbNodes==3)?gmds::GMDS_TRIANGLE:(nbNodes==4)?gmds::GMDS_QUAD:gmds::GMDS_POLYGON;
+		cells.ids[i] = p.id();
+	}
+
+	cells.nodes.resize(cells.offsets[nb]);
+	for(std::size_t i=0; i<nb; i++) {
+		const Lima::Polygone p = ALimaMesh.polygone(i);
+		std::size_t index = cells.offsets[i];
+		for(std::size_t k=0; k<p.nb_noeuds(); k++) {
+			cells.nodes[index++] = nodesIndex_(p.noeud(k).id());
+		}
+	}
+
+	cellsIndex_[2].build(cells.ids);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaFlatReader::readRegions(Lima::Maillage& ALimaMesh)
+{
+	FlatMesh::Cells& cells = mesh_.cells[3];
+	const std::size_t nb = ALimaMesh.nb_polyedres();
+	cells.offsets.resize(nb+1);
+	cells.types.resize(nb);
+	cells.ids.resize(nb);
+
+	cells.offsets[0] = 0;
+	for(std::size_t i=0; i<nb; i++) {
+		const Lima::Polyedre p = ALimaMesh.polyedre(i);
+		cells.offsets[i+1] = cells.offsets[i]+p.nb_noeuds();
+		cells.types[i] = getRegionType(p.type());
+		cells.ids[i] = p.id();
+	}
+
+	cells.nodes.resize(cells.offsets[nb]);
+	for(std::size_t i=0; i<nb; i++) {
+		const Lima::Polyedre p = ALimaMesh.polyedre(i);
+		std::size_t index = cells.offsets[i];
+		for(std::size_t k=0; k<p.nb_noeuds(); k++) {
+			cells.nodes[index++] = nodesIndex_(p.noeud(k).id());
+		}
+	}
+
+	cellsIndex_[3].build(cells.ids);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaFlatReader::readGroups(Lima::Maillage& ALimaMesh, gmds::MeshModel AModel)
+{
+	FlatMesh::Groups& clouds = mesh_.groups[0];
+	clouds.offsets.push_back(0);
+	for(std::size_t iGroup=0; iGroup<ALimaMesh.nb_nuages(); iGroup++) {
+		const Lima::Nuage group = ALimaMesh.nuage(iGroup);
+		clouds.names.push_back(group.nom());
+		for(std::size_t i=0; i<group.nb_noeuds(); i++) {
+			clouds.cells.push_back(nodesIndex_(group.noeud(i).id()));
+		}
+		clouds.offsets.push_back(clouds.cells.size());
+	}
+
+	FlatMesh::Groups& lines = mesh_.groups[1];
+	lines.offsets.push_back(0);
+	for(std::size_t iGroup=0; AModel.has(E) && iGroup<ALimaMesh.nb_lignes(); iGroup++) {
+		const Lima::Ligne group = ALimaMesh.ligne(iGroup);
+		lines.names.push_back(group.nom());
+		for(std::size_t i=0; i<group.nb_bras(); i++) {
+			lines.cells.push_back(cellsIndex_[1](group.bras(i).id()));
+		}
+		lines.offsets.push_back(lines.cells.size());
+	}
+
+	FlatMesh::Groups& surfaces = mesh_.groups[2];
+	surfaces.offsets.push_back(0);
+	for(std::size_t iGroup=0; AModel.has(F) && iGroup<ALimaMesh.nb_surfaces(); iGroup++) {
+		const Lima::Surface group = ALimaMesh.surface(iGroup);
+		surfaces.names.push_back(group.nom());
+		for(std::size_t i=0; i<group.nb_polygones(); i++) {
+			surfaces.cells.push_back(cellsIndex_[2](group.polygone(i).id()));
+		}
+		surfaces.offsets.push_back(surfaces.cells.size());
+	}
+
+	FlatMesh::Groups& volumes = mesh_.groups[3];
+	volumes.offsets.push_back(0);
+	for(std::size_t iGroup=0; AModel.has(R) && iGroup<ALimaMesh.nb_volumes(); iGroup++) {
+		const Lima::Volume group = ALimaMesh.volume(iGroup);
+		volumes.names.push_back(group.nom());
+		for(std::size_t i=0; i<group.nb_polyedres(); i++) {
+			volumes.cells.push_back(cellsIndex_[3](group.polyedre(i).id()));
+		}
+		volumes.offsets.push_back(volumes.cells.size());
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
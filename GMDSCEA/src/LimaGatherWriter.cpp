@@ -0,0 +1,512 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaGatherWriter.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaGatherWriter.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <sstream>
+/*----------------------------------------------------------------------------*/
+#include <Lima/polyedre.h>
+#include "GMDSCEA/LimaMetaFile.h"
+#include "GMDSCEA/LimaWriterAPI.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+template<typename T>
+void
+setAt(std::vector<T>& AVector, const gmds::TCellID AIndex, const T& AValue)
+{
+	if(static_cast<std::size_t>(AIndex) >= AVector.size()) {
+		AVector.resize(AIndex+1, T());
+	}
+	AVector[AIndex] = AValue;
+}
+/*----------------------------------------------------------------------------*/
+/* Number the cells traversed by AIt from ANext, returns the next free id */
+template<typename TIterator>
+Lima::id_type
+numberContiguously(TIterator AIt, Lima::id_type ANext, std::vector<Lima::id_type>& AIDs)
+{
+	AIDs.clear();
+	for(;!AIt.isDone();AIt.next()) {
+		setAt(AIDs, AIt.value().getID(), ANext);
+		ANext++;
+	}
+	return ANext;
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+LimaGatherWriter::LimaGatherWriter(const std::vector<gmds::IGMesh*>& AParts)
+:parts_(AParts),lenghtUnit_(1.)
+{
+	for(int dim=0; dim<4; dim++) {
+		nbCells_[dim] = 0;
+		written_[dim] = true;
+	}
+}
+/*----------------------------------------------------------------------------*/
+LimaGatherWriter::~LimaGatherWriter()
+{
+
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::setLengthUnit(double AUnit)
+{
+	lenghtUnit_ = AUnit;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::setNodesGlobalIDs(const std::vector<std::vector<gmds::TCellID> >& AGlobalIDs)
+{
+	if(AGlobalIDs.size() != parts_.size()) {
+		throw GMDSException("LimaGatherWriter::setNodesGlobalIDs one numbering per partition is expected.");
+	}
+	nodesGlobalIDs_ = AGlobalIDs;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::setOptions(const WriterOptions& AOptions)
+{
+	try {
+		chunks_.setOptions(AOptions);
+	}
+	catch(GMDSException& e) {
+		throw GMDSException(std::string("LimaGatherWriter::setOptions ")+e.what());
+	}
+}
+/*----------------------------------------------------------------------------*/
+const MeshStatistics&
+LimaGatherWriter::getStatistics() const
+{
+	return chunks_.getStatistics();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::write(const std::string& AFileName, gmds::MeshModel AModel)
+{
+	if(parts_.empty()) {
+		throw GMDSException("LimaGatherWriter::write no partition to write.");
+	}
+
+	// the global ids are indexed by the gmds ids of the nodes
+	for(std::size_t i=0; i<nodesGlobalIDs_.size(); i++) {
+		gmds::IGMesh::node_iterator it = parts_[i]->nodes_begin();
+		for(;!it.isDone();it.next()) {
+			if(static_cast<std::size_t>(it.value().getID()) >= nodesGlobalIDs_[i].size()) {
+				std::ostringstream msg;
+				msg<<"LimaGatherWriter::write no global id for node "<<it.value().getID()
+				   <<" of partition "<<i;
+				throw GMDSException(msg.str());
+			}
+		}
+	}
+
+	// a dimension is written if it is asked for and all the partitions
+	// have it
+	const int dimFlags[4] = {N, E, F, R};
+	for(int dim=0; dim<4; dim++) {
+		written_[dim] = (dim == 0) || AModel.has(dimFlags[dim]);
+		for(std::size_t i=0; i<parts_.size() && written_[dim]; i++) {
+			written_[dim] = parts_[i]->getModel().has(dimFlags[dim]);
+		}
+	}
+
+	numberNodes();
+	numberCells();
+
+	int meshDim = 0;
+	for(std::size_t i=0; i<parts_.size(); i++) {
+		meshDim = std::max(meshDim, (int) parts_[i]->getDim());
+	}
+
+	chunks_.write(AFileName, meshDim, lenghtUnit_, [this]() {
+		writeNodes();
+		writeEdges();
+		writeFaces();
+		writeRegions();
+
+		writeClouds();
+		writeLines();
+		writeSurfaces();
+		writeVolumes();
+	}, "LimaGatherWriter::write");
+
+	LimaMetaFile meta;
+	chunks_.writeMetaFile(AFileName,meta);
+
+	for(int dim=0; dim<4; dim++) {
+		limaIDs_[dim].clear();
+	}
+	nodesOwned_.clear();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::numberNodes()
+{
+	limaIDs_[0].assign(parts_.size(), std::vector<Lima::id_type>());
+	nodesOwned_.assign(parts_.size(), std::vector<bool>());
+
+	// Lima id of each global id already written
+	std::vector<Lima::id_type> globalToLima;
+
+	Lima::id_type next = 1;
+	for(std::size_t i=0; i<parts_.size(); i++) {
+		gmds::IGMesh::node_iterator it_nodes = parts_[i]->nodes_begin();
+		for(;!it_nodes.isDone();it_nodes.next()) {
+			const gmds::TCellID id = it_nodes.value().getID();
+
+			if(nodesGlobalIDs_.empty()) {
+				setAt(limaIDs_[0][i], id, next);
+				setAt(nodesOwned_[i], id, true);
+				next++;
+				continue;
+			}
+
+			const gmds::TCellID globalID = nodesGlobalIDs_[i][id];
+			if(static_cast<std::size_t>(globalID) >= globalToLima.size()) {
+				globalToLima.resize(globalID+1, 0);
+			}
+			if(globalToLima[globalID] == 0) {
+				// first partition holding this node
+				globalToLima[globalID] = next;
+				setAt(nodesOwned_[i], id, true);
+				next++;
+			}
+			else {
+				setAt(nodesOwned_[i], id, false);
+			}
+			setAt(limaIDs_[0][i], id, globalToLima[globalID]);
+		}
+	}
+	nbCells_[0] = next-1;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::numberCells()
+{
+	for(int dim=1; dim<4; dim++) {
+		limaIDs_[dim].assign(parts_.size(), std::vector<Lima::id_type>());
+	}
+
+	Lima::id_type nextEdge = 1, nextFace = 1, nextRegion = 1;
+	for(std::size_t i=0; i<parts_.size(); i++) {
+		if(written_[1]) {
+			nextEdge   = numberContiguously(parts_[i]->edges_begin(),  nextEdge,  limaIDs_[1][i]);
+		}
+		if(written_[2]) {
+			nextFace   = numberContiguously(parts_[i]->faces_begin(),  nextFace,  limaIDs_[2][i]);
+		}
+		if(written_[3]) {
+			nextRegion = numberContiguously(parts_[i]->regions_begin(),nextRegion,limaIDs_[3][i]);
+		}
+	}
+	nbCells_[1] = nextEdge-1;
+	nbCells_[2] = nextFace-1;
+	nbCells_[3] = nextRegion-1;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::writeNodes()
+{
+	chunks_.beginNodes(nbCells_[0],true,1);
+
+	for(std::size_t i=0; i<parts_.size(); i++) {
+		gmds::IGMesh::node_iterator it_nodes = parts_[i]->nodes_begin();
+		for(;!it_nodes.isDone();it_nodes.next()) {
+			Node n = it_nodes.value();
+			if(nodesOwned_[i][n.getID()]) {
+				chunks_.addNode(n.X(),n.Y(),n.Z(),limaIDs_[0][i][n.getID()]);
+			}
+		}
+	}
+
+	chunks_.endNodes();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::writeEdges()
+{
+	chunks_.beginCells(1,nbCells_[1],true,1,2);
+	if(!written_[1]) {
+		return;
+	}
+
+	std::vector<gmds::TCellID> nodesIDs;
+	for(std::size_t i=0; i<parts_.size(); i++) {
+		const std::vector<Lima::id_type>& nodeLimaIDs = limaIDs_[0][i];
+		gmds::IGMesh::edge_iterator it_edges = parts_[i]->edges_begin();
+		for(;!it_edges.isDone();it_edges.next()) {
+			Edge e = it_edges.value();
+			e.getAllIDs<gmds::Node>(nodesIDs);
+			Lima::id_type* edge2nodes = chunks_.addCell(limaIDs_[1][i][e.getID()],2);
+			edge2nodes[0] = nodeLimaIDs[nodesIDs[0]];
+			edge2nodes[1] = nodeLimaIDs[nodesIDs[1]];
+		}
+	}
+
+	chunks_.endCells();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::writeFaces()
+{
+	chunks_.beginCells(2,nbCells_[2],true,1);
+	if(!written_[2]) {
+		return;
+	}
+
+	std::vector<gmds::TCellID> nodesIDs;
+	for(std::size_t i=0; i<parts_.size(); i++) {
+		const std::vector<Lima::id_type>& nodeLimaIDs = limaIDs_[0][i];
+		gmds::IGMesh::face_iterator it_faces = parts_[i]->faces_begin();
+		for(;!it_faces.isDone();it_faces.next()) {
+			Face f = it_faces.value();
+			f.getAllIDs<gmds::Node>(nodesIDs);
+			chunks_.addCellType(f.getType());
+
+			Lima::id_type* face2nodes = chunks_.addCell(limaIDs_[2][i][f.getID()],nodesIDs.size());
+			for(std::size_t k=0; k<nodesIDs.size(); k++) {
+				face2nodes[k] = nodeLimaIDs[nodesIDs[k]];
+			}
+		}
+	}
+
+	chunks_.endCells();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::writeRegions()
+{
+	chunks_.beginCells(3,nbCells_[3],true,1);
+	if(!written_[3]) {
+		return;
+	}
+
+	std::vector<gmds::TCellID> nodesIDs;
+	for(std::size_t i=0; i<parts_.size(); i++) {
+		const std::vector<Lima::id_type>& nodeLimaIDs = limaIDs_[0][i];
+		gmds::IGMesh::region_iterator it_regions = parts_[i]->regions_begin();
+		for(;!it_regions.isDone();it_regions.next()) {
+			Region r = it_regions.value();
+			r.getAllIDs<gmds::Node>(nodesIDs);
+			chunks_.addCellType(r.getType());
+
+			Lima::id_type* region2nodes = chunks_.addCell(limaIDs_[3][i][r.getID()],nodesIDs.size(),
+					LimaWriterAPI::getLimaRegionType(r.getType()));
+			for(std::size_t k=0; k<nodesIDs.size(); k++) {
+				region2nodes[k] = nodeLimaIDs[nodesIDs[k]];
+			}
+		}
+	}
+
+	chunks_.endCells();
+}
+/*----------------------------------------------------------------------------*/
+std::vector<std::string>
+LimaGatherWriter::getGroupNames(int ADim)
+{
+	std::vector<std::string> names;
+	for(std::size_t i=0; i<parts_.size() && written_[ADim]; i++) {
+		gmds::IGMesh& part = *parts_[i];
+		int nbGroups = 0;
+		switch(ADim) {
+		case 0 : nbGroups = part.getNbClouds();   break;
+		case 1 : nbGroups = part.getNbLines();    break;
+		case 2 : nbGroups = part.getNbSurfaces(); break;
+		default: nbGroups = part.getNbVolumes();  break;
+		}
+		for(int iGroup=0; iGroup<nbGroups; iGroup++) {
+			std::string name;
+			switch(ADim) {
+			case 0 : name = part.getCloud(iGroup).name();   break;
+			case 1 : name = part.getLine(iGroup).name();    break;
+			case 2 : name = part.getSurface(iGroup).name(); break;
+			default: name = part.getVolume(iGroup).name();  break;
+			}
+			if(std::find(names.begin(),names.end(),name) == names.end()) {
+				names.push_back(name);
+			}
+		}
+	}
+	return names;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::writeClouds()
+{
+	std::vector<std::string> names = getGroupNames(0);
+	std::vector<Lima::id_type> sizes(names.size(),0);
+
+	// a node shared by several partitions may belong to the cloud in each
+	// of them, it is counted and written once: stamp[id] records the last
+	// pass that met the node.
+	std::vector<Lima::id_type> stamp(nbCells_[0]+1,0);
+	Lima::id_type pass = 0;
+
+	for(std::size_t iName=0; iName<names.size(); iName++) {
+		pass++;
+		for(std::size_t i=0; i<parts_.size(); i++) {
+			for(int iCloud=0; iCloud<parts_[i]->getNbClouds(); iCloud++) {
+				gmds::IGMesh::cloud& cl = parts_[i]->getCloud(iCloud);
+				if(cl.name() != names[iName]) {
+					continue;
+				}
+				std::vector<gmds::TCellID> nodeIDs = cl.cellIDs();
+				for(std::size_t iNode=0; iNode<nodeIDs.size(); iNode++) {
+					const Lima::id_type id = limaIDs_[0][i][nodeIDs[iNode]];
+					if(stamp[id] != pass) {
+						stamp[id] = pass;
+						sizes[iName]++;
+					}
+				}
+			}
+		}
+	}
+
+	chunks_.beginGroups(0,names,sizes);
+
+	for(std::size_t iName=0; iName<names.size(); iName++) {
+		pass++;
+		chunks_.beginGroup(names[iName]);
+		for(std::size_t i=0; i<parts_.size(); i++) {
+			for(int iCloud=0; iCloud<parts_[i]->getNbClouds(); iCloud++) {
+				gmds::IGMesh::cloud& cl = parts_[i]->getCloud(iCloud);
+				if(cl.name() != names[iName]) {
+					continue;
+				}
+				std::vector<gmds::TCellID> nodeIDs = cl.cellIDs();
+				for(std::size_t iNode=0; iNode<nodeIDs.size(); iNode++) {
+					const Lima::id_type id = limaIDs_[0][i][nodeIDs[iNode]];
+					if(stamp[id] != pass) {
+						stamp[id] = pass;
+						chunks_.addGroupCell(id);
+					}
+				}
+			}
+		}
+		chunks_.endGroup();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::writeLines()
+{
+	std::vector<std::string> names = getGroupNames(1);
+	std::vector<Lima::id_type> sizes(names.size(),0);
+
+	for(std::size_t iName=0; iName<names.size(); iName++) {
+		for(std::size_t i=0; i<parts_.size(); i++) {
+			for(int iLine=0; iLine<parts_[i]->getNbLines(); iLine++) {
+				gmds::IGMesh::line& l = parts_[i]->getLine(iLine);
+				if(l.name() == names[iName]) {
+					sizes[iName] += l.size();
+				}
+			}
+		}
+	}
+
+	chunks_.beginGroups(1,names,sizes);
+
+	for(std::size_t iName=0; iName<names.size(); iName++) {
+		chunks_.beginGroup(names[iName]);
+		for(std::size_t i=0; i<parts_.size(); i++) {
+			for(int iLine=0; iLine<parts_[i]->getNbLines(); iLine++) {
+				gmds::IGMesh::line& l = parts_[i]->getLine(iLine);
+				if(l.name() != names[iName]) {
+					continue;
+				}
+				std::vector<gmds::TCellID> edgeIDs = l.cellIDs();
+				for(std::size_t iEdge=0; iEdge<edgeIDs.size(); iEdge++) {
+					chunks_.addGroupCell(limaIDs_[1][i][edgeIDs[iEdge]]);
+				}
+			}
+		}
+		chunks_.endGroup();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::writeSurfaces()
+{
+	std::vector<std::string> names = getGroupNames(2);
+	std::vector<Lima::id_type> sizes(names.size(),0);
+
+	for(std::size_t iName=0; iName<names.size(); iName++) {
+		for(std::size_t i=0; i<parts_.size(); i++) {
+			for(int iSurf=0; iSurf<parts_[i]->getNbSurfaces(); iSurf++) {
+				gmds::IGMesh::surface& surf = parts_[i]->getSurface(iSurf);
+				if(surf.name() == names[iName]) {
+					sizes[iName] += surf.size();
+				}
+			}
+		}
+	}
+
+	chunks_.beginGroups(2,names,sizes);
+
+	for(std::size_t iName=0; iName<names.size(); iName++) {
+		chunks_.beginGroup(names[iName]);
+		for(std::size_t i=0; i<parts_.size(); i++) {
+			for(int iSurf=0; iSurf<parts_[i]->getNbSurfaces(); iSurf++) {
+				gmds::IGMesh::surface& surf = parts_[i]->getSurface(iSurf);
+				if(surf.name() != names[iName]) {
+					continue;
+				}
+				std::vector<gmds::TCellID> faceIDs = surf.cellIDs();
+				for(std::size_t iFace=0; iFace<faceIDs.size(); iFace++) {
+					chunks_.addGroupCell(limaIDs_[2][i][faceIDs[iFace]],
+							(parts_[i]->get<gmds::Face>(faceIDs[iFace])).getNbNodes());
+				}
+			}
+		}
+		chunks_.endGroup();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaGatherWriter::writeVolumes()
+{
+	std::vector<std::string> names = getGroupNames(3);
+	std::vector<Lima::id_type> sizes(names.size(),0);
+
+	for(std::size_t iName=0; iName<names.size(); iName++) {
+		for(std::size_t i=0; i<parts_.size(); i++) {
+			for(int iVol=0; iVol<parts_[i]->getNbVolumes(); iVol++) {
+				gmds::IGMesh::volume& vol = parts_[i]->getVolume(iVol);
+				if(vol.name() == names[iName]) {
+					sizes[iName] += vol.size();
+				}
+			}
+		}
+	}
+
+	chunks_.beginGroups(3,names,sizes);
+
+	for(std::size_t iName=0; iName<names.size(); iName++) {
+		chunks_.beginGroup(names[iName]);
+		for(std::size_t i=0; i<parts_.size(); i++) {
+			for(int iVol=0; iVol<parts_[i]->getNbVolumes(); iVol++) {
+				gmds::IGMesh::volume& vol = parts_[i]->getVolume(iVol);
+				if(vol.name() != names[iName]) {
+					continue;
+				}
+				std::vector<gmds::TCellID> regionIDs = vol.cellIDs();
+				for(std::size_t iRegion=0; iRegion<regionIDs.size(); iRegion++) {
+					chunks_.addGroupCell(limaIDs_[3][i][regionIDs[iRegion]],0,
+							LimaWriterAPI::getLimaRegionType((parts_[i]->get<gmds::Region>(regionIDs[iRegion])).getType()));
+				}
+			}
+		}
+		chunks_.endGroup();
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,77 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaIDIndex.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaIDIndex.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+LimaIDIndex::LimaIDIndex()
+:first_(1)
+{
+
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaIDIndex::build(const std::vector<Lima::id_type>& AIDs)
+{
+	clear();
+	first_ = AIDs.empty()?1:AIDs[0];
+
+	bool contiguous = true;
+	for(std::size_t i=0; i<AIDs.size() && contiguous; i++) {
+		contiguous = (AIDs[i] == first_+i);
+	}
+	if(contiguous) {
+		return;
+	}
+
+	// a table indexed by the ids is only used if it is not much larger than
+	// the ids themselves, ids beyond 2^32 must not allocate 2^32 entries
+	const Lima::id_type maxID = *std::max_element(AIDs.begin(),AIDs.end());
+	if(maxID < 2*AIDs.size()+1024) {
+		dense_.assign(maxID+1, 0);
+		for(std::size_t i=0; i<AIDs.size(); i++) {
+			dense_[AIDs[i]] = i;
+		}
+	}
+	else {
+		sparse_.resize(AIDs.size());
+		for(std::size_t i=0; i<AIDs.size(); i++) {
+			sparse_[i] = std::make_pair(AIDs[i],i);
+		}
+		std::sort(sparse_.begin(),sparse_.end());
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaIDIndex::clear()
+{
+	first_ = 1;
+	dense_.clear();
+	sparse_.clear();
+}
+/*----------------------------------------------------------------------------*/
+std::size_t
+LimaIDIndex::operator()(const Lima::id_type AID) const
+{
+	if(!dense_.empty()) {
+		return dense_[AID];
+	}
+	if(!sparse_.empty()) {
+		std::vector<std::pair<Lima::id_type, std::size_t> >::const_iterator it =
+				std::lower_bound(sparse_.begin(),sparse_.end(),std::make_pair(AID,std::size_t(0)));
+		if(it == sparse_.end() || it->first != AID) {
+			throw GMDSException("LimaIDIndex unknown Lima id.");
+		}
+		return it->second;
+	}
+	return AID-first_;
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,116 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaMemoryFile.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaMemoryFile.h"
+/*----------------------------------------------------------------------------*/
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+/*----------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaMetaFile.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+LimaMemoryFile::LimaMemoryFile(const std::string& ASuffix)
+{
+	std::string name = getDirectory()+"/gmdscea_XXXXXX"+ASuffix;
+	std::vector<char> buf(name.begin(),name.end());
+	buf.push_back('\0');
+
+	const int fd = mkstemps(&buf[0],ASuffix.size());
+	if(fd < 0) {
+		throw GMDSException("LimaMemoryFile unable to create "+name+" : "+std::strerror(errno));
+	}
+	close(fd);
+	path_ = &buf[0];
+}
+/*----------------------------------------------------------------------------*/
+LimaMemoryFile::~LimaMemoryFile()
+{
+	unlink(path_.c_str());
+	// a metadata file written next to it by a writer
+	unlink(LimaMetaFile::getPath(path_).c_str());
+}
+/*----------------------------------------------------------------------------*/
+const std::string&
+LimaMemoryFile::path() const
+{
+	return path_;
+}
+/*----------------------------------------------------------------------------*/
+std::string
+LimaMemoryFile::getDirectory()
+{
+	struct stat st;
+	if(stat("/dev/shm",&st) == 0 && S_ISDIR(st.st_mode) && access("/dev/shm",W_OK) == 0) {
+		return "/dev/shm";
+	}
+	const char* tmp = std::getenv("TMPDIR");
+	if(tmp && *tmp) {
+		return tmp;
+	}
+	return "/tmp";
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaMemoryFile::load(std::vector<char>& ABuffer) const
+{
+	const int fd = open(path_.c_str(),O_RDONLY);
+	if(fd < 0) {
+		throw GMDSException("LimaMemoryFile::load unable to open "+path_);
+	}
+	struct stat st;
+	if(fstat(fd,&st) != 0) {
+		close(fd);
+		throw GMDSException("LimaMemoryFile::load unable to stat "+path_);
+	}
+
+	ABuffer.resize(st.st_size);
+	std::size_t done = 0;
+	while(done < ABuffer.size()) {
+		const ssize_t nb = read(fd,&ABuffer[done],ABuffer.size()-done);
+		if(nb < 0 && errno == EINTR) {
+			continue;
+		}
+		if(nb <= 0) {
+			close(fd);
+			throw GMDSException("LimaMemoryFile::load unable to read "+path_);
+		}
+		done += nb;
+	}
+	close(fd);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaMemoryFile::store(const char* AData, std::size_t ASize)
+{
+	const int fd = open(path_.c_str(),O_WRONLY|O_TRUNC);
+	if(fd < 0) {
+		throw GMDSException("LimaMemoryFile::store unable to open "+path_);
+	}
+	std::size_t done = 0;
+	while(done < ASize) {
+		const ssize_t nb = write(fd,AData+done,ASize-done);
+		if(nb < 0 && errno == EINTR) {
+			continue;
+		}
+		if(nb <= 0) {
+			close(fd);
+			throw GMDSException("LimaMemoryFile::store unable to write "+path_);
+		}
+		done += nb;
+	}
+	close(fd);
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
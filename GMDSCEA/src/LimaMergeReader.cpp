@@ -0,0 +1,781 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaMergeReader.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaMergeReader.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#ifdef GMDSCEA_HDF5_THREADSAFE
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#else
+#include <cerrno>
+#include <csignal>
+#include <map>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaFlatReader.h"
+#include "GMDSCEA/LimaPartitionIndex.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+#ifndef GMDSCEA_HDF5_THREADSAFE
+/* serialization of a FlatMesh sent by a worker process to the merge */
+template<typename T>
+void
+pack(std::string& AOut, const T& AValue)
+{
+	AOut.append(reinterpret_cast<const char*>(&AValue),sizeof(T));
+}
+/*----------------------------------------------------------------------------*/
+template<typename T>
+void
+pack(std::string& AOut, const std::vector<T>& AValues)
+{
+	pack(AOut,static_cast<uint64_t>(AValues.size()));
+	if(!AValues.empty()) {
+		AOut.append(reinterpret_cast<const char*>(&AValues[0]),AValues.size()*sizeof(T));
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+pack(std::string& AOut, const std::vector<std::string>& AValues)
+{
+	pack(AOut,static_cast<uint64_t>(AValues.size()));
+	for(std::size_t i=0; i<AValues.size(); i++) {
+		pack(AOut,static_cast<uint64_t>(AValues[i].size()));
+		AOut.append(AValues[i]);
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+pack(std::string& AOut, const FlatMesh& AMesh)
+{
+	pack(AOut,AMesh.dim);
+	pack(AOut,AMesh.lengthUnit);
+	pack(AOut,AMesh.x);
+	pack(AOut,AMesh.y);
+	pack(AOut,AMesh.z);
+	pack(AOut,AMesh.nodeIDs);
+	for(int d=1; d<4; d++) {
+		pack(AOut,AMesh.cells[d].offsets);
+		pack(AOut,AMesh.cells[d].nodes);
+		pack(AOut,AMesh.cells[d].types);
+		pack(AOut,AMesh.cells[d].ids);
+	}
+	for(int d=0; d<4; d++) {
+		pack(AOut,AMesh.groups[d].names);
+		pack(AOut,AMesh.groups[d].offsets);
+		pack(AOut,AMesh.groups[d].cells);
+	}
+}
+/*----------------------------------------------------------------------------*/
+/* reads back what pack wrote, from the position pos */
+class Unpacker{
+public:
+	Unpacker(const std::string& AData, std::size_t APos):data_(AData),pos_(APos) {}
+
+	template<typename T>
+	void get(T& AValue) {
+		read(&AValue,sizeof(T));
+	}
+
+	template<typename T>
+	void get(std::vector<T>& AValues) {
+		uint64_t size;
+		get(size);
+		AValues.resize(size);
+		if(size > 0) {
+			read(&AValues[0],size*sizeof(T));
+		}
+	}
+
+	void get(std::vector<std::string>& AValues) {
+		uint64_t size;
+		get(size);
+		AValues.resize(size);
+		for(std::size_t i=0; i<AValues.size(); i++) {
+			uint64_t length;
+			get(length);
+			if(length > data_.size()-pos_) {
+				throw GMDSException("LimaMergeReader::read truncated data from a worker process");
+			}
+			AValues[i].assign(data_,pos_,length);
+			pos_ += length;
+		}
+	}
+
+	void get(FlatMesh& AMesh) {
+		get(AMesh.dim);
+		get(AMesh.lengthUnit);
+		get(AMesh.x);
+		get(AMesh.y);
+		get(AMesh.z);
+		get(AMesh.nodeIDs);
+		for(int d=1; d<4; d++) {
+			get(AMesh.cells[d].offsets);
+			get(AMesh.cells[d].nodes);
+			get(AMesh.cells[d].types);
+			get(AMesh.cells[d].ids);
+		}
+		for(int d=0; d<4; d++) {
+			get(AMesh.groups[d].names);
+			get(AMesh.groups[d].offsets);
+			get(AMesh.groups[d].cells);
+		}
+	}
+
+private:
+	void read(void* AOut, std::size_t ASize) {
+		if(ASize > data_.size()-pos_) {
+			throw GMDSException("LimaMergeReader::read truncated data from a worker process");
+		}
+		std::memcpy(AOut,data_.data()+pos_,ASize);
+		pos_ += ASize;
+	}
+
+	const std::string& data_;
+	std::size_t pos_;
+};
+/*----------------------------------------------------------------------------*/
+/* write the whole buffer to AFd */
+bool
+writeAll(int AFd, const std::string& AData)
+{
+	std::size_t done = 0;
+	while(done < AData.size()) {
+		const ssize_t n = ::write(AFd,AData.data()+done,AData.size()-done);
+		if(n < 0 && errno == EINTR) {
+			continue;
+		}
+		if(n <= 0) {
+			return false;
+		}
+		done += n;
+	}
+	return true;
+}
+#endif
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+LimaMergeReader::LimaMergeReader(gmds::IGMesh& AMesh)
+:mesh_(AMesh),nbWorkers_(0),tolerance_(0.),lenghtUnit_(1.)
+{
+
+}
+/*----------------------------------------------------------------------------*/
+LimaMergeReader::~LimaMergeReader()
+{
+
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaMergeReader::setNbWorkers(int ANbWorkers)
+{
+	nbWorkers_ = ANbWorkers;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaMergeReader::setTolerance(double ATolerance)
+{
+	tolerance_ = ATolerance;
+}
+/*----------------------------------------------------------------------------*/
+double
+LimaMergeReader::getLengthUnit() const
+{
+	return lenghtUnit_;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaMergeReader::read(const std::string& AIndexFile, gmds::MeshModel AModel)
+{
+	LimaPartitionIndex index;
+	index.read(AIndexFile);
+
+	std::vector<std::string> files;
+	for(std::size_t i=0; i<index.getNbPartitions(); i++) {
+		files.push_back(index.getPartitionPath(i));
+	}
+	readAll(files,index.hasGlobalNodeIDs(),AModel);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaMergeReader::read(const std::vector<std::string>& AFiles, gmds::MeshModel AModel)
+{
+	readAll(AFiles,false,AModel);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaMergeReader::readPartition(const std::string& AFile, gmds::MeshModel AModel,
+		FlatMesh& APart)
+{
+	LimaFlatReader reader(APart);
+	reader.read(AFile,AModel);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaMergeReader::readAll(const std::vector<std::string>& AFiles, bool AGlobalIDs,
+		gmds::MeshModel AModel)
+{
+	if(mesh_.getNbNodes()!=0 || mesh_.getNbEdges()!=0 ||
+	   mesh_.getNbFaces()!=0 || mesh_.getNbRegions()!=0) {
+		throw GMDSException("LimaMergeReader::read the partitions can only be merged in an empty mesh");
+	}
+	globalToMesh_.clear();
+	nodesGrid_.clear();
+	for(int dim=0; dim<4; dim++) {
+		cellsByNodes_[dim].clear();
+		groupsCells_[dim].clear();
+	}
+
+	// the cells that the target mesh cannot store are not read
+	int flags = N;
+	const gmds::MeshModel meshModel = mesh_.getModel();
+	if(AModel.has(E) && meshModel.has(E)) flags |= E;
+	if(AModel.has(F) && meshModel.has(F)) flags |= F;
+	if(AModel.has(R) && meshModel.has(R)) flags |= R;
+	const gmds::MeshModel model(flags);
+
+	int nbWorkers = nbWorkers_;
+	if(nbWorkers <= 0) {
+		nbWorkers = std::thread::hardware_concurrency();
+	}
+	if(nbWorkers <= 0) {
+		nbWorkers = 1;
+	}
+
+	std::string failure;
+	readWithWorkers(AFiles,AGlobalIDs,model,nbWorkers,failure);
+
+	globalToMesh_.clear();
+	nodesGrid_.clear();
+	for(int dim=0; dim<4; dim++) {
+		cellsByNodes_[dim].clear();
+		groupsCells_[dim].clear();
+	}
+
+	if(!failure.empty()) {
+		std::cerr<<"GMDSCEA ERREUR LimaMergeReader::read "<<failure<<std::endl;
+		throw GMDSException("LimaMergeReader::read "+failure);
+	}
+}
+/*----------------------------------------------------------------------------*/
+#ifdef GMDSCEA_HDF5_THREADSAFE
+void
+LimaMergeReader::readWithWorkers(const std::vector<std::string>& AFiles, bool AGlobalIDs,
+		gmds::MeshModel AModel, int ANbWorkers, std::string& AFailure)
+{
+	const int nbParts = AFiles.size();
+	// number of partitions read ahead of the merge, it bounds the memory
+	// used by the flat meshes
+	const int window = ANbWorkers+1;
+
+	std::vector<std::unique_ptr<FlatMesh> > parts(nbParts);
+	std::vector<std::string> errors(nbParts);
+	std::vector<bool> ready(nbParts,false);
+
+	std::mutex mutex;
+	std::condition_variable cond;
+	int next = 0;
+	int nbMerged = 0;
+	bool abort = false;
+
+	std::vector<std::thread> workers;
+	for(int iWorker=0; iWorker<ANbWorkers && iWorker<nbParts; iWorker++) {
+		workers.push_back(std::thread([&]() {
+			for(;;) {
+				int i;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					cond.wait(lock, [&]() {
+						return abort || next>=nbParts || next<nbMerged+window;
+					});
+					if(abort || next>=nbParts) {
+						return;
+					}
+					i = next++;
+				}
+
+				std::unique_ptr<FlatMesh> part(new FlatMesh());
+				std::string error;
+				try {
+					readPartition(AFiles[i],AModel,*part);
+				}
+				catch(std::exception& e) {
+					error = e.what();
+				}
+				catch(...) {
+					error = "unknown error in a worker thread";
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					parts[i] = std::move(part);
+					errors[i] = error;
+					ready[i] = true;
+				}
+				cond.notify_all();
+			}
+		}));
+	}
+
+	// merge in partition order, as soon as each partition is read
+	for(int i=0; i<nbParts && AFailure.empty(); i++) {
+		std::unique_ptr<FlatMesh> part;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			cond.wait(lock, [&]() { return (bool) ready[i]; });
+			part = std::move(parts[i]);
+			AFailure = errors[i];
+		}
+		if(AFailure.empty()) {
+			try {
+				merge(*part,AGlobalIDs);
+				lenghtUnit_ = part->lengthUnit;
+			}
+			catch(std::exception& e) {
+				AFailure = e.what();
+			}
+		}
+		if(!AFailure.empty()) {
+			AFailure = AFiles[i]+" : "+AFailure;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			nbMerged = i+1;
+			abort = !AFailure.empty();
+		}
+		cond.notify_all();
+	}
+
+	for(std::size_t i=0; i<workers.size(); i++) {
+		workers[i].join();
+	}
+}
+#else
+/*----------------------------------------------------------------------------*/
+void
+LimaMergeReader::readWithWorkers(const std::vector<std::string>& AFiles, bool AGlobalIDs,
+		gmds::MeshModel AModel, int ANbWorkers, std::string& AFailure)
+{
+	// HDF5 is not thread-safe: each file is read in a process forked for
+	// it, while the previous ones are merged.
+	const int nbParts = AFiles.size();
+	// number of partitions read ahead of the merge, it bounds the memory
+	// used by the received data
+	const int window = ANbWorkers+1;
+
+	// a worker writes 'o' followed by the packed FlatMesh, or 'e' followed
+	// by the error message, then exits
+	struct Worker {
+		pid_t pid;
+		int fd;
+	};
+	std::map<int, Worker> running;
+	std::vector<std::string> data(nbParts);
+	std::vector<bool> received(nbParts,false);
+	int next = 0;
+
+	std::vector<char> buffer(1<<20);
+	std::vector<struct pollfd> fds;
+	std::vector<int> polled;
+
+	for(int i=0; i<nbParts && AFailure.empty(); i++) {
+		while(!received[i] && AFailure.empty()) {
+			while(next<nbParts && next<i+window && (int) running.size()<ANbWorkers) {
+				int pipeFds[2];
+				if(pipe(pipeFds) != 0) {
+					AFailure = "unable to create a pipe";
+					break;
+				}
+				const pid_t pid = fork();
+				if(pid < 0) {
+					close(pipeFds[0]);
+					close(pipeFds[1]);
+					AFailure = "unable to fork a worker process";
+					break;
+				}
+				if(pid == 0) {
+					close(pipeFds[0]);
+					std::string out;
+					try {
+						FlatMesh part;
+						readPartition(AFiles[next],AModel,part);
+						out = "o";
+						pack(out,part);
+					}
+					catch(std::exception& e) {
+						out = "e";
+						out += e.what();
+					}
+					catch(...) {
+						// the child must never unwind into the stack of the caller
+						out = "eunknown error in a worker process";
+					}
+					const bool ok = writeAll(pipeFds[1],out);
+					close(pipeFds[1]);
+					_exit(ok?0:1);
+				}
+				close(pipeFds[1]);
+				Worker w = {pid, pipeFds[0]};
+				running[next++] = w;
+			}
+			if(!AFailure.empty()) {
+				break;
+			}
+
+			fds.clear();
+			polled.clear();
+			for(std::map<int, Worker>::const_iterator it=running.begin(); it!=running.end(); ++it) {
+				struct pollfd p;
+				p.fd = it->second.fd;
+				p.events = POLLIN;
+				p.revents = 0;
+				fds.push_back(p);
+				polled.push_back(it->first);
+			}
+			if(poll(&fds[0],fds.size(),-1) < 0) {
+				if(errno == EINTR) {
+					continue;
+				}
+				AFailure = "unable to wait for the worker processes";
+				break;
+			}
+
+			for(std::size_t iFd=0; iFd<fds.size(); iFd++) {
+				if(fds[iFd].revents == 0) {
+					continue;
+				}
+				const int part = polled[iFd];
+				const ssize_t n = ::read(fds[iFd].fd,&buffer[0],buffer.size());
+				if(n < 0 && errno == EINTR) {
+					continue;
+				}
+				if(n > 0) {
+					data[part].append(&buffer[0],n);
+					continue;
+				}
+
+				// end of the data of this worker
+				Worker w = running[part];
+				running.erase(part);
+				close(w.fd);
+				int status = 0;
+				while(waitpid(w.pid,&status,0) < 0 && errno == EINTR) {}
+				if(n < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0 || data[part].empty()) {
+					data[part] = "eworker process failed";
+				}
+				received[part] = true;
+			}
+		}
+		if(!AFailure.empty()) {
+			break;
+		}
+
+		// merge in partition order, as soon as each partition is received
+		try {
+			if(data[i][0] != 'o') {
+				throw GMDSException(data[i].substr(1));
+			}
+			FlatMesh part;
+			Unpacker(data[i],1).get(part);
+			std::string().swap(data[i]);
+			merge(part,AGlobalIDs);
+			lenghtUnit_ = part.lengthUnit;
+		}
+		catch(std::exception& e) {
+			AFailure = AFiles[i]+" : "+e.what();
+		}
+	}
+
+	// on failure, the workers still running are stopped
+	for(std::map<int, Worker>::const_iterator it=running.begin(); it!=running.end(); ++it) {
+		kill(it->second.pid,SIGTERM);
+		close(it->second.fd);
+		int status;
+		while(waitpid(it->second.pid,&status,0) < 0 && errno == EINTR) {}
+	}
+}
+#endif
+/*----------------------------------------------------------------------------*/
+gmds::TCellID
+LimaMergeReader::findOrCreateNode(const FlatMesh& APart, const std::size_t AIndex,
+		bool AGlobalIDs)
+{
+	const double coords[3] = {APart.x[AIndex], APart.y[AIndex], APart.z[AIndex]};
+
+	if(AGlobalIDs) {
+		std::pair<std::unordered_map<Lima::id_type, gmds::TCellID>::iterator, bool> it =
+				globalToMesh_.insert(std::make_pair(APart.nodeIDs[AIndex],gmds::NullID));
+		if(it.second) {
+			it.first->second = mesh_.newNode(coords[0],coords[1],coords[2]).getID();
+		}
+		return it.first->second;
+	}
+
+	if(tolerance_ <= 0.) {
+		return mesh_.newNode(coords[0],coords[1],coords[2]).getID();
+	}
+
+	// a matching node lies in the cell of the node or in one of its
+	// neighbours
+	CellKey key;
+	for(int iDim=0; iDim<3; iDim++) {
+		key[iDim] = (long long) std::floor(coords[iDim]/tolerance_);
+	}
+
+	const double tol2 = tolerance_*tolerance_;
+	CellKey neighbour;
+	for(int i=-1; i<=1; i++) {
+		for(int j=-1; j<=1; j++) {
+			for(int k=-1; k<=1; k++) {
+				neighbour[0] = key[0]+i;
+				neighbour[1] = key[1]+j;
+				neighbour[2] = key[2]+k;
+				std::map<CellKey, std::vector<gmds::TCellID> >::const_iterator it = nodesGrid_.find(neighbour);
+				if(it == nodesGrid_.end()) {
+					continue;
+				}
+				for(std::size_t iNode=0; iNode<it->second.size(); iNode++) {
+					gmds::Node n = mesh_.get<gmds::Node>(it->second[iNode]);
+					const double dx = n.X()-coords[0];
+					const double dy = n.Y()-coords[1];
+					const double dz = n.Z()-coords[2];
+					if(dx*dx+dy*dy+dz*dz <= tol2) {
+						return n.getID();
+					}
+				}
+			}
+		}
+	}
+
+	gmds::Node n = mesh_.newNode(coords[0],coords[1],coords[2]);
+	nodesGrid_[key].push_back(n.getID());
+	return n.getID();
+}
+/*----------------------------------------------------------------------------*/
+gmds::TCellID&
+LimaMergeReader::findCell(int ADim, const FlatMesh::Cells& ACells, const std::size_t AIndex,
+		const std::vector<gmds::TCellID>& ANodesMap)
+{
+	// the same cell may be oriented differently in two partitions
+	key_.clear();
+	for(std::size_t j=ACells.offsets[AIndex]; j<ACells.offsets[AIndex+1]; j++) {
+		key_.push_back(ANodesMap[ACells.nodes[j]]);
+	}
+	std::sort(key_.begin(),key_.end());
+
+	return cellsByNodes_[ADim].insert(std::make_pair(key_,gmds::NullID)).first->second;
+}
+/*----------------------------------------------------------------------------*/
+bool
+LimaMergeReader::addToGroup(int ADim, const std::string& AName, gmds::TCellID AID)
+{
+	std::vector<bool>& inGroup = groupsCells_[ADim][AName];
+	if(static_cast<std::size_t>(AID) >= inGroup.size()) {
+		inGroup.resize(AID+1, false);
+	}
+	if(inGroup[AID]) {
+		return false;
+	}
+	inGroup[AID] = true;
+	return true;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaMergeReader::merge(const FlatMesh& APart, bool AGlobalIDs)
+{
+	// ids in mesh_ of the cells of APart, by index in APart
+	std::vector<gmds::TCellID> nodesMap(APart.x.size());
+	std::vector<gmds::TCellID> cellsMap[4];
+	std::vector<gmds::Node> nodes;
+
+	for(std::size_t i=0; i<nodesMap.size(); i++) {
+		nodesMap[i] = findOrCreateNode(APart,i,AGlobalIDs);
+	}
+
+	// without shared nodes, no cell can be shared
+	const bool shared = AGlobalIDs || tolerance_ > 0.;
+
+	const FlatMesh::Cells& edges = APart.cells[1];
+	cellsMap[1].resize(APart.getNbCells(1));
+	for(std::size_t i=0; i<cellsMap[1].size(); i++) {
+		gmds::TCellID* known = shared?&findCell(1,edges,i,nodesMap):0;
+		if(known && *known != gmds::NullID) {
+			cellsMap[1][i] = *known;
+			continue;
+		}
+
+		const std::size_t* n = &edges.nodes[edges.offsets[i]];
+		cellsMap[1][i] = mesh_.newEdge(mesh_.get<gmds::Node>(nodesMap[n[0]]),
+									   mesh_.get<gmds::Node>(nodesMap[n[1]])).getID();
+		if(known) {
+			*known = cellsMap[1][i];
+		}
+	}
+
+	const FlatMesh::Cells& faces = APart.cells[2];
+	cellsMap[2].resize(APart.getNbCells(2));
+	for(std::size_t i=0; i<cellsMap[2].size(); i++) {
+		gmds::TCellID* known = shared?&findCell(2,faces,i,nodesMap):0;
+		if(known && *known != gmds::NullID) {
+			cellsMap[2][i] = *known;
+			continue;
+		}
+
+		nodes.clear();
+		for(std::size_t j=faces.offsets[i]; j<faces.offsets[i+1]; j++) {
+			nodes.push_back(mesh_.get<gmds::Node>(nodesMap[faces.nodes[j]]));
+		}
+
+		gmds::Face newFace;
+		switch(faces.types[i]) {
+		case GMDS_TRIANGLE :
+			newFace = mesh_.newTriangle(nodes[0],nodes[1],nodes[2]);
+			break;
+		case GMDS_QUAD :
+			newFace = mesh_.newQuad(nodes[0],nodes[1],nodes[2],nodes[3]);
+			break;
+		default :
+			newFace = mesh_.newPolygon(nodes);
+			break;
+		}
+		cellsMap[2][i] = newFace.getID();
+		if(known) {
+			*known = cellsMap[2][i];
+		}
+	}
+
+	const FlatMesh::Cells& regions = APart.cells[3];
+	cellsMap[3].resize(APart.getNbCells(3));
+	for(std::size_t i=0; i<cellsMap[3].size(); i++) {
+		gmds::TCellID* known = shared?&findCell(3,regions,i,nodesMap):0;
+		if(known && *known != gmds::NullID) {
+			cellsMap[3][i] = *known;
+			continue;
+		}
+
+		nodes.clear();
+		for(std::size_t j=regions.offsets[i]; j<regions.offsets[i+1]; j++) {
+			nodes.push_back(mesh_.get<gmds::Node>(nodesMap[regions.nodes[j]]));
+		}
+
+		gmds::Region newRegion;
+		switch(regions.types[i]) {
+		case GMDS_TETRA :
+			newRegion = mesh_.newTet(nodes[0],nodes[1],nodes[2],nodes[3]);
+			break;
+		case GMDS_PYRAMID :
+			newRegion = mesh_.newPyramid(nodes[0],nodes[1],nodes[2],nodes[3],nodes[4]);
+			break;
+		case GMDS_PRISM3 :
+			newRegion = mesh_.newPrism3(nodes[0],nodes[1],nodes[2],nodes[3],nodes[4],nodes[5]);
+			break;
+		case GMDS_HEX :
+			newRegion = mesh_.newHex(nodes[0],nodes[1],nodes[2],nodes[3],nodes[4],nodes[5],nodes[6],nodes[7]);
+			break;
+		default :
+			throw GMDSException("LimaMergeReader::merge cannot merge this type of region.");
+		}
+		cellsMap[3][i] = newRegion.getID();
+		if(known) {
+			*known = cellsMap[3][i];
+		}
+	}
+
+	// groups, merged by name; a shared cell may already be in the group
+	const FlatMesh::Groups& clouds = APart.groups[0];
+	for(std::size_t iCloud=0; iCloud<clouds.names.size(); iCloud++) {
+		gmds::IGMesh::cloud* cl = 0;
+		for(int i=0; i<mesh_.getNbClouds() && !cl; i++) {
+			if(mesh_.getCloud(i).name() == clouds.names[iCloud]) {
+				cl = &mesh_.getCloud(i);
+			}
+		}
+		if(!cl) {
+			cl = &mesh_.newCloud(clouds.names[iCloud]);
+		}
+		for(std::size_t i=clouds.offsets[iCloud]; i<clouds.offsets[iCloud+1]; i++) {
+			const gmds::TCellID id = nodesMap[clouds.cells[i]];
+			if(addToGroup(0,clouds.names[iCloud],id)) {
+				cl->add(id);
+			}
+		}
+	}
+
+	const FlatMesh::Groups& lines = APart.groups[1];
+	for(std::size_t iLine=0; iLine<lines.names.size(); iLine++) {
+		gmds::IGMesh::line* l = 0;
+		for(int i=0; i<mesh_.getNbLines() && !l; i++) {
+			if(mesh_.getLine(i).name() == lines.names[iLine]) {
+				l = &mesh_.getLine(i);
+			}
+		}
+		if(!l) {
+			l = &mesh_.newLine(lines.names[iLine]);
+		}
+		for(std::size_t i=lines.offsets[iLine]; i<lines.offsets[iLine+1]; i++) {
+			const gmds::TCellID id = cellsMap[1][lines.cells[i]];
+			if(addToGroup(1,lines.names[iLine],id)) {
+				l->add(id);
+			}
+		}
+	}
+
+	const FlatMesh::Groups& surfaces = APart.groups[2];
+	for(std::size_t iSurf=0; iSurf<surfaces.names.size(); iSurf++) {
+		gmds::IGMesh::surface* surf = 0;
+		for(int i=0; i<mesh_.getNbSurfaces() && !surf; i++) {
+			if(mesh_.getSurface(i).name() == surfaces.names[iSurf]) {
+				surf = &mesh_.getSurface(i);
+			}
+		}
+		if(!surf) {
+			surf = &mesh_.newSurface(surfaces.names[iSurf]);
+		}
+		for(std::size_t i=surfaces.offsets[iSurf]; i<surfaces.offsets[iSurf+1]; i++) {
+			const gmds::TCellID id = cellsMap[2][surfaces.cells[i]];
+			if(addToGroup(2,surfaces.names[iSurf],id)) {
+				surf->add(id);
+			}
+		}
+	}
+
+	const FlatMesh::Groups& volumes = APart.groups[3];
+	for(std::size_t iVol=0; iVol<volumes.names.size(); iVol++) {
+		gmds::IGMesh::volume* vol = 0;
+		for(int i=0; i<mesh_.getNbVolumes() && !vol; i++) {
+			if(mesh_.getVolume(i).name() == volumes.names[iVol]) {
+				vol = &mesh_.getVolume(i);
+			}
+		}
+		if(!vol) {
+			vol = &mesh_.newVolume(volumes.names[iVol]);
+		}
+		for(std::size_t i=volumes.offsets[iVol]; i<volumes.offsets[iVol+1]; i++) {
+			const gmds::TCellID id = cellsMap[3][volumes.cells[i]];
+			if(addToGroup(3,volumes.names[iVol],id)) {
+				vol->add(id);
+			}
+		}
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
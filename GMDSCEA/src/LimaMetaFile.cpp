@@ -0,0 +1,113 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaMetaFile.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaMetaFile.h"
+/*----------------------------------------------------------------------------*/
+#include <fstream>
+/*----------------------------------------------------------------------------*/
+#include <unistd.h>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include "GMDSCEA/LimaAtomicFile.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+std::string trim(const std::string& AString)
+{
+	const std::size_t first = AString.find_first_not_of(" \t\r");
+	if(first == std::string::npos) {
+		return "";
+	}
+	const std::size_t last = AString.find_last_not_of(" \t\r");
+	return AString.substr(first,last-first+1);
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+std::string
+LimaMetaFile::getPath(const std::string& AFileName)
+{
+	return AFileName+".meta";
+}
+/*----------------------------------------------------------------------------*/
+bool
+LimaMetaFile::read(const std::string& AFileName)
+{
+	entries_.clear();
+
+	std::ifstream in(getPath(AFileName).c_str());
+	if(!in) {
+		return false;
+	}
+	std::string line;
+	while(std::getline(in,line)) {
+		if(line.empty() || line[0] == '#') {
+			continue;
+		}
+		const std::size_t eq = line.find('=');
+		if(eq == std::string::npos) {
+			continue;
+		}
+		entries_[trim(line.substr(0,eq))] = trim(line.substr(eq+1));
+	}
+	return true;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaMetaFile::write(const std::string& AFileName) const
+{
+	// a temporary file of its own, so that concurrent writers of the same
+	// metadata file cannot mix their contents
+	LimaAtomicFile file(getPath(AFileName));
+	{
+		std::ofstream out(file.path().c_str());
+		out<<"# gmdscea metadata of "<<AFileName<<"\n";
+		for(std::map<std::string,std::string>::const_iterator it = entries_.begin();
+			it != entries_.end(); ++it) {
+			out<<it->first<<" = "<<it->second<<"\n";
+		}
+		if(!out) {
+			throw GMDSException("LimaMetaFile::write unable to write "+file.path());
+		}
+	}
+	file.commit();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaMetaFile::remove(const std::string& AFileName)
+{
+	unlink(getPath(AFileName).c_str());
+}
+/*----------------------------------------------------------------------------*/
+bool
+LimaMetaFile::has(const std::string& AKey) const
+{
+	return entries_.find(AKey) != entries_.end();
+}
+/*----------------------------------------------------------------------------*/
+std::string
+LimaMetaFile::get(const std::string& AKey) const
+{
+	std::map<std::string,std::string>::const_iterator it = entries_.find(AKey);
+	return it == entries_.end()?std::string():it->second;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaMetaFile::set(const std::string& AKey, const std::string& AValue)
+{
+	entries_[AKey] = AValue;
+}
+/*----------------------------------------------------------------------------*/
+const std::map<std::string,std::string>&
+LimaMetaFile::getEntries() const
+{
+	return entries_;
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,155 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaPartitionIndex.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaPartitionIndex.h"
+/*----------------------------------------------------------------------------*/
+#include <fstream>
+#include <sstream>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+std::string
+getDirectory(const std::string& AFileName)
+{
+	const std::string::size_type pos = AFileName.find_last_of('/');
+	if(pos == std::string::npos) {
+		return std::string();
+	}
+	return AFileName.substr(0,pos+1);
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+LimaPartitionIndex::LimaPartitionIndex()
+:globalNodeIDs_(false)
+{}
+/*----------------------------------------------------------------------------*/
+void
+LimaPartitionIndex::addPartition(const std::string& AFile, const uint64_t ANbCells[4])
+{
+	Partition part;
+	part.file = AFile;
+	for(int dim=0; dim<4; dim++) {
+		part.nbCells[dim] = ANbCells[dim];
+		part.offsets[dim] = 0;
+		if(!partitions_.empty()) {
+			const Partition& prev = partitions_.back();
+			part.offsets[dim] = prev.offsets[dim]+prev.nbCells[dim];
+		}
+	}
+	partitions_.push_back(part);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaPartitionIndex::setGlobalNodeIDs(bool AGlobal)
+{
+	globalNodeIDs_ = AGlobal;
+}
+/*----------------------------------------------------------------------------*/
+bool
+LimaPartitionIndex::hasGlobalNodeIDs() const
+{
+	return globalNodeIDs_;
+}
+/*----------------------------------------------------------------------------*/
+std::size_t
+LimaPartitionIndex::getNbPartitions() const
+{
+	return partitions_.size();
+}
+/*----------------------------------------------------------------------------*/
+const LimaPartitionIndex::Partition&
+LimaPartitionIndex::getPartition(std::size_t AIndex) const
+{
+	return partitions_.at(AIndex);
+}
+/*----------------------------------------------------------------------------*/
+std::string
+LimaPartitionIndex::getPartitionPath(std::size_t AIndex) const
+{
+	return directory_+partitions_.at(AIndex).file;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaPartitionIndex::write(const std::string& AFileName)
+{
+	std::ofstream out(AFileName.c_str());
+	if(!out) {
+		throw GMDSException("LimaPartitionIndex::write cannot open "+AFileName);
+	}
+	directory_ = getDirectory(AFileName);
+
+	out<<"# gmdscea partition index\n";
+	out<<"version 1\n";
+	out<<"global_node_ids "<<(globalNodeIDs_?1:0)<<"\n";
+	out<<"nb_partitions "<<partitions_.size()<<"\n";
+	out<<"# partition file nb_nodes nb_edges nb_faces nb_regions"
+	   <<" node_offset edge_offset face_offset region_offset\n";
+	for(std::size_t i=0; i<partitions_.size(); i++) {
+		const Partition& part = partitions_[i];
+		out<<"partition "<<part.file;
+		for(int dim=0; dim<4; dim++) {
+			out<<" "<<part.nbCells[dim];
+		}
+		for(int dim=0; dim<4; dim++) {
+			out<<" "<<part.offsets[dim];
+		}
+		out<<"\n";
+	}
+
+	if(!out) {
+		throw GMDSException("LimaPartitionIndex::write error while writing "+AFileName);
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaPartitionIndex::read(const std::string& AFileName)
+{
+	std::ifstream in(AFileName.c_str());
+	if(!in) {
+		throw GMDSException("LimaPartitionIndex::read cannot open "+AFileName);
+	}
+	directory_ = getDirectory(AFileName);
+	globalNodeIDs_ = false;
+	partitions_.clear();
+
+	std::string line;
+	while(std::getline(in,line)) {
+		if(line.empty() || line[0]=='#') {
+			continue;
+		}
+		std::istringstream fields(line);
+		std::string key;
+		fields>>key;
+		if(key == "global_node_ids") {
+			int global = 0;
+			fields>>global;
+			globalNodeIDs_ = (global != 0);
+		}
+		else if(key == "partition") {
+			Partition part;
+			fields>>part.file;
+			for(int dim=0; dim<4; dim++) {
+				fields>>part.nbCells[dim];
+			}
+			for(int dim=0; dim<4; dim++) {
+				fields>>part.offsets[dim];
+			}
+			if(!fields) {
+				throw GMDSException("LimaPartitionIndex::read wrong partition line in "+AFileName);
+			}
+			partitions_.push_back(part);
+		}
+		// version and nb_partitions are informative
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,275 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaPartitionWriter.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaPartitionWriter.h"
+/*----------------------------------------------------------------------------*/
+#include <iostream>
+#include <sstream>
+#include <thread>
+#ifdef GMDSCEA_HDF5_THREADSAFE
+#include <atomic>
+#include <mutex>
+#else
+#include <cerrno>
+#include <map>
+#include <poll.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaPartitionIndex.h"
+#include "GMDSCEA/LimaWriterAPI.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+LimaPartitionWriter::LimaPartitionWriter(const std::vector<gmds::IGMesh*>& AParts)
+:parts_(AParts),lenghtUnit_(1.),nbWorkers_(0)
+{
+
+}
+/*----------------------------------------------------------------------------*/
+LimaPartitionWriter::~LimaPartitionWriter()
+{
+
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaPartitionWriter::setLengthUnit(double AUnit)
+{
+	lenghtUnit_ = AUnit;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaPartitionWriter::setNbWorkers(int ANbWorkers)
+{
+	nbWorkers_ = ANbWorkers;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaPartitionWriter::setNodesGlobalIDs(const std::vector<std::vector<gmds::TCellID> >& AGlobalIDs)
+{
+	if(AGlobalIDs.size() != parts_.size()) {
+		throw GMDSException("LimaPartitionWriter::setNodesGlobalIDs one numbering per partition is expected.");
+	}
+	nodesGlobalIDs_ = AGlobalIDs;
+}
+/*----------------------------------------------------------------------------*/
+std::string
+LimaPartitionWriter::getPartitionFileName(const std::string& ABaseName, int APart)
+{
+	std::ostringstream name;
+	name<<ABaseName<<"_"<<APart<<".mli2";
+	return name.str();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaPartitionWriter::writePartition(int APart, const std::string& AFileName, gmds::MeshModel AModel)
+{
+	gmds::LimaWriterAPI w(*parts_[APart]);
+	w.setLengthUnit(lenghtUnit_);
+
+	if(!nodesGlobalIDs_.empty()) {
+		const std::vector<gmds::TCellID>& globalIDs = nodesGlobalIDs_[APart];
+		std::vector<Lima::id_type> limaIDs(globalIDs.size());
+		for(std::size_t i=0; i<globalIDs.size(); i++) {
+			limaIDs[i] = globalIDs[i]+1; // +1 because mli ids begin at 1
+		}
+		w.setNodesLimaIDs(limaIDs);
+	}
+
+	w.write(AFileName,AModel,true);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaPartitionWriter::write(const std::string& ABaseName, gmds::MeshModel AModel)
+{
+	const int nbParts = parts_.size();
+
+	int nbWorkers = nbWorkers_;
+	if(nbWorkers <= 0) {
+		nbWorkers = std::thread::hardware_concurrency();
+	}
+	if(nbWorkers <= 0) {
+		nbWorkers = 1;
+	}
+
+	// the global ids are indexed by the gmds ids of the nodes
+	for(std::size_t i=0; i<nodesGlobalIDs_.size(); i++) {
+		gmds::IGMesh::node_iterator it = parts_[i]->nodes_begin();
+		for(;!it.isDone();it.next()) {
+			if(static_cast<std::size_t>(it.value().getID()) >= nodesGlobalIDs_[i].size()) {
+				std::ostringstream msg;
+				msg<<"LimaPartitionWriter::write no global id for node "<<it.value().getID()
+				   <<" of partition "<<i;
+				throw GMDSException(msg.str());
+			}
+		}
+	}
+
+	std::vector<bool> failed(nbParts,false);
+
+#ifdef GMDSCEA_HDF5_THREADSAFE
+	// each thread takes the next partition to write
+	std::atomic<int> next(0);
+	std::mutex errorMutex;
+	std::vector<std::thread> workers;
+	for(int iWorker=0; iWorker<nbWorkers && iWorker<nbParts; iWorker++) {
+		workers.push_back(std::thread([&]() {
+			for(int i=next++; i<nbParts; i=next++) {
+				try {
+					writePartition(i,getPartitionFileName(ABaseName,i),AModel);
+				}
+				catch(std::exception& e) {
+					std::lock_guard<std::mutex> lock(errorMutex);
+					std::cerr<<"GMDSCEA ERREUR partition "<<i<<" : "<<e.what()<<std::endl;
+					failed[i] = true;
+				}
+			}
+		}));
+	}
+	for(std::size_t i=0; i<workers.size(); i++) {
+		workers[i].join();
+	}
+#else
+	// HDF5 is not thread-safe: one worker process per partition, at most
+	// nbWorkers at the same time. The partitions are shared with the
+	// workers through copy-on-write memory.
+	// Each worker holds the write end of a pipe, closed when it exits: the
+	// parent polls the pipes and only waits for its own workers, the other
+	// children of the application are left alone.
+	struct Worker {
+		pid_t pid;
+		int fd;
+	};
+	std::map<int, Worker> running;
+	int next = 0;
+	std::string forkFailure;
+	std::vector<struct pollfd> fds;
+	std::vector<int> polled;
+	while((next < nbParts && forkFailure.empty()) || !running.empty()) {
+		while(next < nbParts && forkFailure.empty() && (int) running.size() < nbWorkers) {
+			int pipeFds[2];
+			if(pipe(pipeFds) != 0) {
+				// the workers already started are waited for below
+				forkFailure = "unable to create a pipe";
+				break;
+			}
+			std::cout.flush();
+			std::cerr.flush();
+			const pid_t pid = fork();
+			if(pid < 0) {
+				close(pipeFds[0]);
+				close(pipeFds[1]);
+				forkFailure = "unable to fork a worker process";
+				break;
+			}
+			if(pid == 0) {
+				close(pipeFds[0]);
+				int status = 0;
+				try {
+					writePartition(next,getPartitionFileName(ABaseName,next),AModel);
+				}
+				catch(std::exception& e) {
+					std::cerr<<"GMDSCEA ERREUR partition "<<next<<" : "<<e.what()<<std::endl;
+					status = 1;
+				}
+				catch(...) {
+					std::cerr<<"GMDSCEA ERREUR partition "<<next<<std::endl;
+					status = 1;
+				}
+				_exit(status);
+			}
+			close(pipeFds[1]);
+			Worker w = {pid, pipeFds[0]};
+			running[next++] = w;
+		}
+		if(running.empty()) {
+			break;
+		}
+
+		// wait for any worker, so that a long partition does not hold the
+		// slots freed by the others
+		fds.clear();
+		polled.clear();
+		for(std::map<int, Worker>::const_iterator it=running.begin(); it!=running.end(); ++it) {
+			struct pollfd p;
+			p.fd = it->second.fd;
+			p.events = POLLIN;
+			p.revents = 0;
+			fds.push_back(p);
+			polled.push_back(it->first);
+		}
+		if(poll(&fds[0],fds.size(),-1) < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			// the workers are stopped, their partitions are failed
+			for(std::map<int, Worker>::const_iterator it=running.begin(); it!=running.end(); ++it) {
+				kill(it->second.pid,SIGTERM);
+				close(it->second.fd);
+				int status;
+				while(waitpid(it->second.pid,&status,0) < 0 && errno == EINTR) {}
+				failed[it->first] = true;
+			}
+			running.clear();
+			break;
+		}
+
+		for(std::size_t iFd=0; iFd<fds.size(); iFd++) {
+			if(fds[iFd].revents == 0) {
+				continue;
+			}
+			// the workers write nothing: the pipe is readable at their exit
+			const int part = polled[iFd];
+			Worker w = running[part];
+			running.erase(part);
+			close(w.fd);
+			int status = 0;
+			pid_t waited;
+			while((waited = waitpid(w.pid,&status,0)) < 0 && errno == EINTR) {}
+			if(waited < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+				failed[part] = true;
+			}
+		}
+	}
+	if(!forkFailure.empty()) {
+		throw GMDSException("LimaPartitionWriter::write "+forkFailure+".");
+	}
+#endif
+
+	std::ostringstream errors;
+	for(int i=0; i<nbParts; i++) {
+		if(failed[i]) {
+			errors<<" "<<i;
+		}
+	}
+	if(!errors.str().empty()) {
+		throw GMDSException("LimaPartitionWriter::write failure of partition(s)"+errors.str());
+	}
+
+	LimaPartitionIndex index;
+	index.setGlobalNodeIDs(!nodesGlobalIDs_.empty());
+	for(int i=0; i<nbParts; i++) {
+		// the index stores names relative to its own directory
+		std::string file = getPartitionFileName(ABaseName,i);
+		const std::string::size_type pos = file.find_last_of('/');
+		if(pos != std::string::npos) {
+			file = file.substr(pos+1);
+		}
+		const uint64_t nbCells[4] = {
+				static_cast<uint64_t>(parts_[i]->getNbNodes()),
+				static_cast<uint64_t>(parts_[i]->getNbEdges()),
+				static_cast<uint64_t>(parts_[i]->getNbFaces()),
+				static_cast<uint64_t>(parts_[i]->getNbRegions())};
+		index.addPartition(file,nbCells);
+	}
+	index.write(ABaseName+".idx");
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,275 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaStager.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaStager.h"
+/*----------------------------------------------------------------------------*/
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+/*----------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include "GMDSCEA/LimaAtomicFile.h"
+#include "GMDSCEA/LimaMetaFile.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+std::string
+directory(const std::string& AFileName)
+{
+	const std::size_t slash = AFileName.rfind('/');
+	return (slash == std::string::npos)?".":AFileName.substr(0,slash+1);
+}
+/*----------------------------------------------------------------------------*/
+/* flush the content of AFileName (a file or a directory) to disk */
+void
+sync(const std::string& AFileName, bool ADirectory)
+{
+	const int fd = open(AFileName.c_str(),ADirectory?O_RDONLY|O_DIRECTORY:O_RDONLY);
+	if(fd < 0) {
+		throw GMDSException("LimaStager unable to open "+AFileName+" : "+std::strerror(errno));
+	}
+	const int res = fsync(fd);
+	close(fd);
+	// some file systems do not sync directories
+	if(res != 0 && !(ADirectory && errno == EINVAL)) {
+		throw GMDSException("LimaStager unable to sync "+AFileName+" : "+std::strerror(errno));
+	}
+}
+/*----------------------------------------------------------------------------*/
+/* copy ASource into a temporary file renamed to AFileName once on disk */
+void
+copy(const std::string& ASource, const std::string& AFileName)
+{
+	struct stat st;
+	if(stat(ASource.c_str(),&st) != 0) {
+		throw GMDSException("LimaStager unable to stat "+ASource+" : "+std::strerror(errno));
+	}
+	// permissions of the file replaced, or of the staged file
+	struct stat target;
+	const mode_t mode = (stat(AFileName.c_str(),&target) == 0)?
+			target.st_mode & 07777 : st.st_mode & 07777;
+
+	LimaAtomicFile file(AFileName);
+
+	const int in = open(ASource.c_str(),O_RDONLY);
+	if(in < 0) {
+		throw GMDSException("LimaStager unable to open "+ASource+" : "+std::strerror(errno));
+	}
+	const int out = open(file.path().c_str(),O_WRONLY|O_TRUNC);
+	if(out < 0) {
+		close(in);
+		throw GMDSException("LimaStager unable to open "+file.path()+" : "+std::strerror(errno));
+	}
+
+	std::vector<char> buf(1<<20);
+	std::string error;
+	ssize_t nb;
+	while(error.empty() && (nb = read(in,&buf[0],buf.size())) != 0) {
+		if(nb < 0) {
+			if(errno != EINTR) {
+				error = "unable to read "+ASource+" : "+std::strerror(errno);
+			}
+			continue;
+		}
+		ssize_t written = 0;
+		while(written < nb) {
+			const ssize_t w = write(out,&buf[written],nb-written);
+			if(w < 0) {
+				if(errno != EINTR) {
+					error = "unable to write "+file.path()+" : "+std::strerror(errno);
+					break;
+				}
+				continue;
+			}
+			written += w;
+		}
+	}
+	if(error.empty() && fsync(out) != 0) {
+		error = "unable to sync "+file.path()+" : "+std::strerror(errno);
+	}
+	if(close(out) != 0 && error.empty()) {
+		error = "unable to close "+file.path()+" : "+std::strerror(errno);
+	}
+	close(in);
+	if(!error.empty()) {
+		// the temporary file is removed by its destructor
+		throw GMDSException("LimaStager "+error);
+	}
+	file.commit(mode);
+}
+/*----------------------------------------------------------------------------*/
+/* move ASource to AFileName, its content being on disk beforehand */
+void
+moveFile(const std::string& ASource, const std::string& AFileName)
+{
+	sync(ASource,false);
+	if(std::rename(ASource.c_str(),AFileName.c_str()) == 0) {
+		return;
+	}
+	if(errno != EXDEV) {
+		throw GMDSException("LimaStager unable to move "+ASource+" to "+AFileName+" : "+std::strerror(errno));
+	}
+	// not on the same file system
+	copy(ASource,AFileName);
+	unlink(ASource.c_str());
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+LimaStager::LimaStager(const std::string& AScratchDir, int ANbThreads)
+:scratchDir_(AScratchDir),nbStaged_(0),stop_(false)
+{
+	if(mkdir(scratchDir_.c_str(),0777) != 0 && errno != EEXIST) {
+		throw GMDSException("LimaStager unable to create "+scratchDir_+" : "+std::strerror(errno));
+	}
+	if(ANbThreads <= 0) {
+		ANbThreads = 1;
+	}
+	for(int i=0; i<ANbThreads; i++) {
+		threads_.push_back(std::thread(&LimaStager::run,this));
+	}
+}
+/*----------------------------------------------------------------------------*/
+LimaStager::~LimaStager()
+{
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+	queued_.notify_all();
+	for(std::size_t i=0; i<threads_.size(); i++) {
+		threads_[i].join();
+	}
+}
+/*----------------------------------------------------------------------------*/
+std::string
+LimaStager::getStagedPath(const std::string& AFileName)
+{
+	const std::size_t slash = AFileName.rfind('/');
+	const std::string base = (slash == std::string::npos)?AFileName:AFileName.substr(slash+1);
+
+	// the pid distinguishes the processes sharing the scratch directory
+	std::ostringstream path;
+	std::unique_lock<std::mutex> lock(mutex_);
+	path<<scratchDir_<<"/"<<getpid()<<"."<<nbStaged_++<<"."<<base;
+	return path.str();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaStager::migrate(const std::string& AStagedPath, const std::string& AFileName)
+{
+	wait(AFileName);
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		queue_.push_back(std::make_pair(AStagedPath,AFileName));
+		pending_.insert(AFileName);
+	}
+	queued_.notify_one();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaStager::wait(const std::string& AFileName)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	while(pending_.count(AFileName) != 0) {
+		done_.wait(lock);
+	}
+}
+/*----------------------------------------------------------------------------*/
+bool
+LimaStager::barrier()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	while(!pending_.empty()) {
+		done_.wait(lock);
+	}
+	lastErrors_.swap(errors_);
+	errors_.clear();
+	return lastErrors_.empty();
+}
+/*----------------------------------------------------------------------------*/
+const std::vector<std::string>&
+LimaStager::getErrors() const
+{
+	return lastErrors_;
+}
+/*----------------------------------------------------------------------------*/
+int
+LimaStager::getNbPending() const
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	return pending_.size();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaStager::run()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	while(true) {
+		while(queue_.empty() && !stop_) {
+			queued_.wait(lock);
+		}
+		// the queue is emptied before stopping
+		if(queue_.empty()) {
+			return;
+		}
+		const std::pair<std::string,std::string> m = queue_.front();
+		queue_.pop_front();
+
+		lock.unlock();
+		std::string error;
+		try {
+			move(m.first,m.second);
+		}
+		catch(GMDSException& e) {
+			error = e.what();
+		}
+		catch(std::exception& e) {
+			error = e.what();
+		}
+		if(!error.empty()) {
+			unlink(m.first.c_str());
+			LimaMetaFile::remove(m.first);
+			std::cerr<<"GMDSCEA ERREUR LimaStager : "<<error<<std::endl;
+		}
+		lock.lock();
+
+		if(!error.empty()) {
+			errors_.push_back(m.second+" : "+error);
+		}
+		pending_.erase(pending_.find(m.second));
+		done_.notify_all();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaStager::move(const std::string& AStagedPath, const std::string& AFileName)
+{
+	moveFile(AStagedPath,AFileName);
+
+	// the metadata describes the new file, a stale one is removed
+	struct stat st;
+	const std::string meta = LimaMetaFile::getPath(AStagedPath);
+	if(stat(meta.c_str(),&st) == 0) {
+		moveFile(meta,LimaMetaFile::getPath(AFileName));
+	}
+	else {
+		LimaMetaFile::remove(AFileName);
+	}
+
+	sync(directory(AFileName),true);
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,270 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaTranscoder.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaTranscoder.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <iostream>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include <Lima/erreur.h>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+/* tells whether the ids of the ANb cells given by ACell(i) are
+ * AFirst, AFirst+1, ... */
+template<typename TAccessor>
+bool
+isContiguous(const Lima::size_type ANb, TAccessor ACell, Lima::id_type& AFirst)
+{
+	AFirst = (ANb>0)?ACell(0).id():1;
+	for(Lima::size_type i=1; i<ANb; i++) {
+		if(ACell(i).id() != AFirst+i) {
+			return false;
+		}
+	}
+	return true;
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+LimaTranscoder::LimaTranscoder()
+{
+	for(int dim=0; dim<4; dim++) {
+		nbCells_[dim] = 0;
+	}
+}
+/*----------------------------------------------------------------------------*/
+LimaTranscoder::~LimaTranscoder()
+{
+
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaTranscoder::setChunkSize(Lima::id_type AChunkSize)
+{
+	if(AChunkSize == 0) {
+		throw GMDSException("LimaTranscoder::setChunkSize the chunk size must be positive.");
+	}
+	chunks_.setChunkSize(AChunkSize);
+}
+/*----------------------------------------------------------------------------*/
+Lima::id_type
+LimaTranscoder::getNbCells(int ADim) const
+{
+	if(ADim < 0 || ADim > 3) {
+		throw GMDSException("LimaTranscoder::getNbCells wrong dimension.");
+	}
+	return nbCells_[ADim];
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaTranscoder::transcode(const std::string& AInput, const std::string& AOutput)
+{
+	Lima::Maillage m;
+	try {
+		m.lire(AInput);
+	}
+	catch(...) {
+		throw GMDSException("Lima cannot read the file "+AInput);
+	}
+
+	nbCells_[0] = m.nb_noeuds();
+	nbCells_[1] = m.nb_bras();
+	nbCells_[2] = m.nb_polygones();
+	nbCells_[3] = m.nb_polyedres();
+
+	int dim = 1;
+	if(m.dimension() == Lima::D3) {
+		dim = 3;
+	} else if(m.dimension() == Lima::D2) {
+		dim = 2;
+	}
+
+	try {
+		chunks_.write(AOutput, dim, m.unite_longueur(), [&]() {
+			writeNodes(m);
+			writeEdges(m);
+			writeFaces(m);
+			writeRegions(m);
+
+			writeClouds(m);
+			writeLines(m);
+			writeSurfaces(m);
+			writeVolumes(m);
+		}, "LimaTranscoder::transcode");
+	}
+	catch(Lima::erreur& e) {
+		// an error of the source mesh, the write errors are already raised
+		// as GMDSException
+		std::cerr<<"GMDSCEA ERREUR LimaTranscoder::transcode : "<<e.what()<<std::endl;
+		throw GMDSException(e.what());
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaTranscoder::writeNodes(Lima::Maillage& AMesh)
+{
+	const Lima::size_type nb = AMesh.nb_noeuds();
+	Lima::id_type first;
+	const bool contiguous = isContiguous(nb, [&](Lima::size_type i) { return AMesh.noeud(i); }, first);
+	chunks_.beginNodes(nb,contiguous,first);
+
+	for(Lima::size_type i=0; i<nb; i++) {
+		const Lima::Noeud n = AMesh.noeud(i);
+		chunks_.addNode(n.x(),n.y(),n.z(),n.id());
+	}
+
+	chunks_.endNodes();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaTranscoder::writeEdges(Lima::Maillage& AMesh)
+{
+	const Lima::size_type nb = AMesh.nb_bras();
+	Lima::id_type first;
+	const bool contiguous = isContiguous(nb, [&](Lima::size_type i) { return AMesh.bras(i); }, first);
+	chunks_.beginCells(1,nb,contiguous,first,2);
+
+	for(Lima::size_type i=0; i<nb; i++) {
+		const Lima::Bras b = AMesh.bras(i);
+		Lima::id_type* edge2nodes = chunks_.addCell(b.id(),2);
+		edge2nodes[0] = b.noeud(0).id();
+		edge2nodes[1] = b.noeud(1).id();
+	}
+
+	chunks_.endCells();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaTranscoder::writeFaces(Lima::Maillage& AMesh)
+{
+	const Lima::size_type nb = AMesh.nb_polygones();
+	Lima::id_type first;
+	const bool contiguous = isContiguous(nb, [&](Lima::size_type i) { return AMesh.polygone(i); }, first);
+	chunks_.beginCells(2,nb,contiguous,first);
+
+	for(Lima::size_type i=0; i<nb; i++) {
+		const Lima::Polygone p = AMesh.polygone(i);
+		Lima::id_type* face2nodes = chunks_.addCell(p.id(),p.nb_noeuds());
+		for(Lima::size_type k=0; k<p.nb_noeuds(); k++) {
+			face2nodes[k] = p.noeud(k).id();
+		}
+	}
+
+	chunks_.endCells();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaTranscoder::writeRegions(Lima::Maillage& AMesh)
+{
+	const Lima::size_type nb = AMesh.nb_polyedres();
+	Lima::id_type first;
+	const bool contiguous = isContiguous(nb, [&](Lima::size_type i) { return AMesh.polyedre(i); }, first);
+	chunks_.beginCells(3,nb,contiguous,first);
+
+	for(Lima::size_type i=0; i<nb; i++) {
+		const Lima::Polyedre p = AMesh.polyedre(i);
+		Lima::id_type* region2nodes = chunks_.addCell(p.id(),p.nb_noeuds(),p.type());
+		for(Lima::size_type k=0; k<p.nb_noeuds(); k++) {
+			region2nodes[k] = p.noeud(k).id();
+		}
+	}
+
+	chunks_.endCells();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaTranscoder::writeClouds(Lima::Maillage& AMesh)
+{
+	std::vector<std::string> names;
+	std::vector<Lima::id_type> sizes;
+	for(Lima::size_type iGroup=0; iGroup<AMesh.nb_nuages(); iGroup++) {
+		names.push_back(AMesh.nuage(iGroup).nom());
+		sizes.push_back(AMesh.nuage(iGroup).nb_noeuds());
+	}
+	chunks_.beginGroups(0,names,sizes);
+
+	for(Lima::size_type iGroup=0; iGroup<AMesh.nb_nuages(); iGroup++) {
+		const Lima::Nuage group = AMesh.nuage(iGroup);
+		chunks_.beginGroup(names[iGroup]);
+		for(Lima::size_type i=0; i<group.nb_noeuds(); i++) {
+			chunks_.addGroupCell(group.noeud(i).id());
+		}
+		chunks_.endGroup();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaTranscoder::writeLines(Lima::Maillage& AMesh)
+{
+	std::vector<std::string> names;
+	std::vector<Lima::id_type> sizes;
+	for(Lima::size_type iGroup=0; iGroup<AMesh.nb_lignes(); iGroup++) {
+		names.push_back(AMesh.ligne(iGroup).nom());
+		sizes.push_back(AMesh.ligne(iGroup).nb_bras());
+	}
+	chunks_.beginGroups(1,names,sizes);
+
+	for(Lima::size_type iGroup=0; iGroup<AMesh.nb_lignes(); iGroup++) {
+		const Lima::Ligne group = AMesh.ligne(iGroup);
+		chunks_.beginGroup(names[iGroup]);
+		for(Lima::size_type i=0; i<group.nb_bras(); i++) {
+			chunks_.addGroupCell(group.bras(i).id());
+		}
+		chunks_.endGroup();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaTranscoder::writeSurfaces(Lima::Maillage& AMesh)
+{
+	std::vector<std::string> names;
+	std::vector<Lima::id_type> sizes;
+	for(Lima::size_type iGroup=0; iGroup<AMesh.nb_surfaces(); iGroup++) {
+		names.push_back(AMesh.surface(iGroup).nom());
+		sizes.push_back(AMesh.surface(iGroup).nb_polygones());
+	}
+	chunks_.beginGroups(2,names,sizes);
+
+	for(Lima::size_type iGroup=0; iGroup<AMesh.nb_surfaces(); iGroup++) {
+		const Lima::Surface group = AMesh.surface(iGroup);
+		chunks_.beginGroup(names[iGroup]);
+		for(Lima::size_type i=0; i<group.nb_polygones(); i++) {
+			const Lima::Polygone p = group.polygone(i);
+			chunks_.addGroupCell(p.id(),p.nb_noeuds());
+		}
+		chunks_.endGroup();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaTranscoder::writeVolumes(Lima::Maillage& AMesh)
+{
+	std::vector<std::string> names;
+	std::vector<Lima::id_type> sizes;
+	for(Lima::size_type iGroup=0; iGroup<AMesh.nb_volumes(); iGroup++) {
+		names.push_back(AMesh.volume(iGroup).nom());
+		sizes.push_back(AMesh.volume(iGroup).nb_polyedres());
+	}
+	chunks_.beginGroups(3,names,sizes);
+
+	for(Lima::size_type iGroup=0; iGroup<AMesh.nb_volumes(); iGroup++) {
+		const Lima::Volume group = AMesh.volume(iGroup);
+		chunks_.beginGroup(names[iGroup]);
+		for(Lima::size_type i=0; i<group.nb_polyedres(); i++) {
+			const Lima::Polyedre p = group.polyedre(i);
+			chunks_.addGroupCell(p.id(),0,p.type());
+		}
+		chunks_.endGroup();
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
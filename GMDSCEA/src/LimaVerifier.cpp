@@ -0,0 +1,151 @@
+/*----------------------------------------------------------------------------*/
+/** \file    LimaVerifier.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaVerifier.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <sstream>
+#include <thread>
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaFlatReader.h"
+#include "GMDSCEA/LimaMetaFile.h"
+#include "GMDSCEA/MeshStatistics.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+const char* dimNames[] = {"nodes", "edges", "faces", "regions"};
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+LimaVerifier::LimaVerifier()
+:nbThreads_(0)
+{
+
+}
+/*----------------------------------------------------------------------------*/
+LimaVerifier::~LimaVerifier()
+{
+
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaVerifier::setNbThreads(int ANbThreads)
+{
+	nbThreads_ = ANbThreads;
+}
+/*----------------------------------------------------------------------------*/
+const std::vector<std::string>&
+LimaVerifier::getErrors() const
+{
+	return errors_;
+}
+/*----------------------------------------------------------------------------*/
+bool
+LimaVerifier::verify(const std::string& AFileName)
+{
+	errors_.clear();
+
+	MeshStatistics stats;
+	if(!MeshStatistics::probe(AFileName,stats) || stats.getChunkSize() == 0) {
+		throw GMDSException("LimaVerifier::verify no chunk checksums for "+AFileName);
+	}
+
+	LimaFlatReader reader(mesh_);
+	try {
+		reader.read(AFileName,N|E|F|R);
+	}
+	catch(GMDSException& e) {
+		errors_.push_back(std::string("unreadable file: ")+e.what());
+		return false;
+	}
+
+	for(int d=0; d<4; d++) {
+		verifyDim(d,stats.getChunkSize(),stats.getChunkChecksums(d));
+	}
+	mesh_.clear();
+
+	return errors_.empty();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaVerifier::verifyDim(int ADim, Lima::id_type AChunkSize,
+		const std::vector<uint64_t>& AChecksums)
+{
+	const std::size_t nb = (ADim==0)?mesh_.x.size():mesh_.getNbCells(ADim);
+	const std::size_t chunkSize = AChunkSize;
+	const std::size_t nbChunks = (nb+chunkSize-1)/chunkSize;
+
+	if(nbChunks != AChecksums.size()) {
+		std::ostringstream s;
+		s<<dimNames[ADim]<<": "<<nbChunks<<" chunks in the file, "
+		 <<AChecksums.size()<<" written";
+		errors_.push_back(s.str());
+		return;
+	}
+
+	int nbThreads = nbThreads_;
+	if(nbThreads <= 0) {
+		nbThreads = std::thread::hardware_concurrency();
+	}
+	if(nbThreads <= 0) {
+		nbThreads = 1;
+	}
+	if(static_cast<std::size_t>(nbThreads) > nbChunks) {
+		nbThreads = nbChunks;
+	}
+
+	std::vector<char> valid(nbChunks,1);
+	// thread t checks the chunks t, t+nbThreads...
+	std::vector<std::thread> threads;
+	for(int t=0; t<nbThreads; t++) {
+		threads.push_back(std::thread([&,t]() {
+			std::vector<Lima::id_type> buffer;
+			for(std::size_t c=t; c<nbChunks; c+=nbThreads) {
+				const std::size_t first = c*chunkSize;
+				const std::size_t last = std::min(first+chunkSize,nb);
+				valid[c] = (hashChunk(ADim,first,last,buffer) == AChecksums[c]);
+			}
+		}));
+	}
+	for(std::size_t t=0; t<threads.size(); t++) {
+		threads[t].join();
+	}
+
+	for(std::size_t c=0; c<nbChunks; c++) {
+		if(!valid[c]) {
+			std::ostringstream s;
+			s<<dimNames[ADim]<<": chunk "<<c<<" ("<<c*chunkSize<<" to "
+			 <<std::min((c+1)*chunkSize,nb)-1<<") does not match its checksum";
+			errors_.push_back(s.str());
+		}
+	}
+}
+/*----------------------------------------------------------------------------*/
+uint64_t
+LimaVerifier::hashChunk(int ADim, std::size_t AFirst, std::size_t ALast,
+		std::vector<Lima::id_type>& ABuffer) const
+{
+	if(ADim == 0) {
+		return MeshStatistics::hashNodeChunk(ALast-AFirst,&mesh_.x[AFirst],
+				&mesh_.y[AFirst],&mesh_.z[AFirst],&mesh_.nodeIDs[AFirst]);
+	}
+
+	// the connectivity is stored as node indices, back to Lima ids
+	const FlatMesh::Cells& cells = mesh_.cells[ADim];
+	const std::size_t begin = cells.offsets[AFirst];
+	const std::size_t end = cells.offsets[ALast];
+	ABuffer.resize(end-begin);
+	for(std::size_t i=begin; i<end; i++) {
+		ABuffer[i-begin] = mesh_.nodeIDs[cells.nodes[i]];
+	}
+	return MeshStatistics::hashCellChunk(ALast-AFirst,ABuffer.empty()?0:&ABuffer[0],
+			ABuffer.size(),&cells.ids[AFirst]);
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
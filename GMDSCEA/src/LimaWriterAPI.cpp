@@ -6,17 +6,125 @@
 /*----------------------------------------------------------------------------*/
 #include "GMDSCEA/LimaWriterAPI.h"
 /*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cmath>
+#include <sstream>
 #include <vector>
 /*----------------------------------------------------------------------------*/
 #include <Lima/malipp.h>
-#include <Lima/erreur.h>
 #include <Lima/polyedre.h>
 #include <GMDS/IG/IG.h>
+#include "GMDSCEA/LimaMemoryFile.h"
+#include "GMDSCEA/LimaMetaFile.h"
 /*----------------------------------------------------------------------------*/
 namespace gmds{
 /*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+/* Traversal of the cells of a mesh, either in container order or in the
+ * order given by a list of ids. It has the interface of the gmds iterators. */
+template<typename TCell, typename TIterator>
+class CellTraversal {
+public:
+	CellTraversal(gmds::IGMesh& AMesh, const TIterator& AIt,
+				  const std::vector<gmds::TCellID>& AOrder)
+	:mesh_(AMesh),it_(AIt),order_(AOrder),index_(0)
+	{}
+
+	bool isDone() const {
+		return order_.empty()?it_.isDone():index_==order_.size();
+	}
+	void next() {
+		if(order_.empty()) {
+			it_.next();
+		}
+		else {
+			index_++;
+		}
+	}
+	TCell value() const {
+		return order_.empty()?it_.value():mesh_.get<TCell>(order_[index_]);
+	}
+
+private:
+	gmds::IGMesh& mesh_;
+	TIterator it_;
+	const std::vector<gmds::TCellID>& order_;
+	std::size_t index_;
+};
+/*----------------------------------------------------------------------------*/
+/* Key of the centroid of the cell defined by ANodeIDs */
+uint64_t
+getCentroidKey(gmds::IGMesh& AMesh, const SpaceFillingCurve& ACurve,
+			   const std::vector<gmds::TCellID>& ANodeIDs)
+{
+	double x = 0., y = 0., z = 0.;
+	for(std::size_t i=0; i<ANodeIDs.size(); i++) {
+		Node n = AMesh.get<gmds::Node>(ANodeIDs[i]);
+		x += n.X();
+		y += n.Y();
+		z += n.Z();
+	}
+	const double nb = ANodeIDs.size();
+	return ACurve.key(x/nb, y/nb, z/nb);
+}
+/*----------------------------------------------------------------------------*/
+/* Sort the cells ACellIDs by key and number them from 1 in this order */
+void
+buildRenumbering(const std::vector<uint64_t>& AKeys,
+				 const std::vector<gmds::TCellID>& ACellIDs,
+				 std::vector<gmds::TCellID>& AOrder,
+				 std::vector<Lima::id_type>& ALimaIDs)
+{
+	std::vector<std::size_t> permutation;
+	SpaceFillingCurve::sort(AKeys, permutation);
+
+	gmds::TCellID maxID = 0;
+	for(std::size_t i=0; i<ACellIDs.size(); i++) {
+		maxID = std::max(maxID, ACellIDs[i]);
+	}
+
+	AOrder.resize(ACellIDs.size());
+	ALimaIDs.assign(ACellIDs.empty()?0:maxID+1, 0);
+	for(std::size_t i=0; i<permutation.size(); i++) {
+		AOrder[i] = ACellIDs[permutation[i]];
+		ALimaIDs[AOrder[i]] = i+1;
+	}
+}
+/*----------------------------------------------------------------------------*/
+/* Number the cells traversed by AIt from 1 in container order. ALimaIDs is
+ * left empty if the ids are already contiguous from 0. */
+template<typename TIterator>
+void
+buildCompaction(TIterator AIt, std::vector<Lima::id_type>& ALimaIDs)
+{
+	ALimaIDs.clear();
+
+	Lima::id_type rank = 0;
+	bool isIdentity = true;
+	for(;!AIt.isDone();AIt.next()) {
+		const gmds::TCellID id = AIt.value().getID();
+		if(static_cast<Lima::id_type>(id) >= ALimaIDs.size()) {
+			ALimaIDs.resize(id+1, 0);
+		}
+		rank++;
+		ALimaIDs[id] = rank;
+		if(static_cast<Lima::id_type>(id)+1 != rank) {
+			isIdentity = false;
+		}
+	}
+
+	if(isIdentity) {
+		ALimaIDs.clear();
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
 LimaWriterAPI::LimaWriterAPI(gmds::IGMesh& AMesh)
-:mesh_(AMesh),lenghtUnit_(1.)
+:mesh_(AMesh),lenghtUnit_(1.),
+ facesNbNodes_(0),regionsNbNodes_(0),regionsType_(Lima::Polyedre::TETRAEDRE),
+ renumbering_(GMDSCEA_RENUMBER_NONE),compact_(false),compactOption_(false)
 {
 
 }
@@ -24,6 +132,96 @@ LimaWriterAPI::LimaWriterAPI(gmds::IGMesh& AMesh)
 LimaWriterAPI::~LimaWriterAPI()
 {
 
+}
+/*----------------------------------------------------------------------------*/
+const MeshStatistics&
+LimaWriterAPI::getStatistics() const
+{
+	return chunks_.getStatistics();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaWriterAPI::releaseBuffers()
+{
+	chunks_.releaseBuffers();
+}
+/*----------------------------------------------------------------------------*/
+Lima::Polyedre::PolyedreType
+LimaWriterAPI::getLimaRegionType(const gmds::ECellType AType)
+{
+	switch(AType) {
+	case gmds::GMDS_TETRA :
+		return Lima::Polyedre::TETRAEDRE;
+	case gmds::GMDS_PYRAMID :
+		return Lima::Polyedre::PYRAMIDE;
+	case gmds::GMDS_PRISM3 :
+		return Lima::Polyedre::PRISME;
+	case gmds::GMDS_HEX :
+		return Lima::Polyedre::HEXAEDRE;
+	default:
+		throw GMDSException("LimaWriterAPI::writeRegions cell type not handled by Lima.");
+	}
+}
+/*----------------------------------------------------------------------------*/
+double
+LimaWriterAPI::getQuantizationStep(const double ATolerance)
+{
+	int exponent;
+	std::frexp(ATolerance,&exponent);
+	return std::ldexp(1.,exponent-1);
+}
+/*----------------------------------------------------------------------------*/
+double
+LimaWriterAPI::roundCoordinate(const double AValue, const ECoordinatePrecision APrecision,
+		const double AStep)
+{
+	switch(APrecision) {
+	case GMDSCEA_COORD_FLOAT :
+		return static_cast<float>(AValue);
+	case GMDSCEA_COORD_QUANTIZED :
+		// snapped on the multiples of AStep, a power of two: the division
+		// and the product are exact
+		return std::floor(AValue/AStep+0.5)*AStep;
+	default :
+		return AValue;
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaWriterAPI::setCompression(Lima::MaliPPWriter2& AWriter, bool ACompression)
+{
+#ifdef GMDSCEA_LIMA_HDF145
+	if(ACompression) {
+		AWriter.activer_compression_zlib();
+	}
+#else
+	// not available, the datasets are not compressed
+	(void) AWriter;
+	(void) ACompression;
+#endif
+}
+/*----------------------------------------------------------------------------*/
+bool
+LimaWriterAPI::hasCompression()
+{
+#ifdef GMDSCEA_LIMA_HDF145
+	return true;
+#else
+	return false;
+#endif
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaWriterAPI::checkOptions(const WriterOptions& AOptions)
+{
+	if(AOptions.precision == GMDSCEA_COORD_QUANTIZED && !(AOptions.tolerance > 0.)) {
+		throw GMDSException("a positive tolerance is needed to quantize the coordinates");
+	}
+	// the reduced precisions only shrink the file through the compression
+	if(!hasCompression() &&
+	   (AOptions.compression || AOptions.precision != GMDSCEA_COORD_DOUBLE)) {
+		throw GMDSException("the compression and the reduced precisions need gmdscea built with GMDSCEA_LIMA_HDF145");
+	}
 }
 /*----------------------------------------------------------------------------*/
 void
@@ -33,32 +231,70 @@ LimaWriterAPI::setLengthUnit(double AUnit)
 }
 /*----------------------------------------------------------------------------*/
 void
+LimaWriterAPI::setOptions(const WriterOptions& AOptions)
+{
+	// nothing is changed when the options are rejected
+	try {
+		chunks_.setOptions(AOptions);
+	}
+	catch(GMDSException& e) {
+		throw GMDSException(std::string("LimaWriterAPI::setOptions ")+e.what());
+	}
+	setRenumbering(AOptions.renumbering);
+	compactOption_ = AOptions.compact;
+}
+/*----------------------------------------------------------------------------*/
+void
 LimaWriterAPI::activateZlibCompression()
 {
-  //WARNING: only available using the hdf145 extension
-  //writer_->activer_compression_zlib();
+	chunks_.setCompression(true);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaWriterAPI::setRenumbering(ERenumbering ARenumbering)
+{
+	renumbering_ = ARenumbering;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaWriterAPI::setNodesLimaIDs(const std::vector<Lima::id_type>& AIDs)
+{
+	userNodeIDs_ = AIDs;
+}
+/*----------------------------------------------------------------------------*/
+const std::vector<Lima::id_type>&
+LimaWriterAPI::getLimaIDs(int ADim) const
+{
+	switch(ADim) {
+	case 0 :
+		return nodeIDs_;
+	case 1 :
+		return edgeIDs_;
+	case 2 :
+		return faceIDs_;
+	case 3 :
+		return regionIDs_;
+	default:
+		throw GMDSException("LimaWriterAPI::getLimaIDs wrong dimension.");
+	}
 }
 /*----------------------------------------------------------------------------*/
 void
 LimaWriterAPI::write(const std::string& AFileName, gmds::MeshModel AModel, int ACompact)
 {
-	try {
-		writer_ = new Lima::MaliPPWriter2(AFileName, 1);
-
-		writer_->unite_longueur(lenghtUnit_);
-		Lima::dim_t dim;
-		if(mesh_.getDim() == 3) {
-			dim = Lima::D3;
-		} else if(mesh_.getDim() == 2) {
-			dim = Lima::D2;
-		} else {
-			dim = Lima::D1;
-		}
-		writer_->dimension(dim);
-
-		writer_->beginWrite();
-
+	writeFile(AFileName,AModel,ACompact,true);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaWriterAPI::writeFile(const std::string& AFileName, gmds::MeshModel AModel,
+		int ACompact, bool AMetaFile)
+{
+	compact_ = ACompact || compactOption_;
 
+	chunks_.write(AFileName, mesh_.getDim(), lenghtUnit_, [this]() {
+		detectFacesType();
+		detectRegionsType();
+		computeRenumbering();
 
 		writeNodes();
 		writeEdges();
@@ -69,102 +305,177 @@ LimaWriterAPI::write(const std::string& AFileName, gmds::MeshModel AModel, int A
 		writeLines();
 		writeSurfaces();
 		writeVolumes();
+	}, "LimaWriterAPI::write");
+
+	if(!AMetaFile) {
+		return;
+	}
+
+	// the metadata of a previous content of the file would be wrong
+	LimaMetaFile meta;
+	const bool holes = addIDCapacities(meta);
+	chunks_.writeMetaFile(AFileName,meta,holes);
+}
+/*----------------------------------------------------------------------------*/
+bool
+LimaWriterAPI::addIDCapacities(LimaMetaFile& AMeta) const
+{
+	// the gmds ids are not kept in the file
+	if(compact_ || renumbering_ != GMDSCEA_RENUMBER_NONE) {
+		return false;
+	}
+
+	const gmds::MeshModel model = mesh_.getModel();
+	const bool hasDim[4] = {userNodeIDs_.empty(), model.has(E), model.has(F), model.has(R)};
+	const gmds::TInt nbCells[4] = {mesh_.getNbNodes(), mesh_.getNbEdges(),
+								   mesh_.getNbFaces(), mesh_.getNbRegions()};
+	const char* keys[4] = {"ids.nodes", "ids.edges", "ids.faces", "ids.regions"};
+
+	bool holes = false;
+	for(int d=0; d<4; d++) {
+		if(!hasDim[d]) {
+			continue;
+		}
+		const gmds::TInt maxID = mesh_.getMaxLocalID(d);
+		const gmds::TInt capacity = (maxID < 0)?0:maxID+1;
+		std::ostringstream value;
+		value<<capacity;
+		AMeta.set(keys[d],value.str());
+		holes = holes || (capacity != nbCells[d]);
+	}
+	return holes;
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaWriterAPI::writeToBuffer(std::vector<char>& ABuffer, gmds::MeshModel AModel, int ACompact)
+{
+	LimaMemoryFile file(".mli2");
+	// no metadata file next to the temporary file
+	writeFile(file.path(),AModel,ACompact,false);
+	file.load(ABuffer);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaWriterAPI::computeRenumbering()
+{
+	nodeOrder_.clear();
+	edgeOrder_.clear();
+	faceOrder_.clear();
+	regionOrder_.clear();
+	nodeIDs_.clear();
+	edgeIDs_.clear();
+	faceIDs_.clear();
+	regionIDs_.clear();
+
+	if(renumbering_ == GMDSCEA_RENUMBER_NONE) {
+		if(compact_) {
+			computeCompaction();
+		}
+		if(!userNodeIDs_.empty()) {
+			nodeIDs_ = userNodeIDs_;
+		}
+		return;
+	}
+
+	SpaceFillingCurve curve(renumbering_);
+	{
+		gmds::IGMesh::node_iterator it_nodes = mesh_.nodes_begin();
+		for(;!it_nodes.isDone();it_nodes.next()) {
+			Node n = it_nodes.value();
+			curve.addToBoundingBox(n.X(),n.Y(),n.Z());
+		}
+	}
+
+	std::vector<uint64_t> keys;
+	std::vector<gmds::TCellID> cellIDs;
+	std::vector<gmds::TCellID> nodesIDs;
 
-		writeNodesAttributes();
-		writeEdgesAttributes();
-		writeFacesAttributes();
-		writeRegionsAttributes();
+	keys.reserve(mesh_.getNbNodes());
+	cellIDs.reserve(mesh_.getNbNodes());
+	for(gmds::IGMesh::node_iterator it = mesh_.nodes_begin();!it.isDone();it.next()) {
+		Node n = it.value();
+		keys.push_back(curve.key(n.X(),n.Y(),n.Z()));
+		cellIDs.push_back(n.getID());
+	}
+	buildRenumbering(keys,cellIDs,nodeOrder_,nodeIDs_);
+	if(!userNodeIDs_.empty()) {
+		nodeIDs_ = userNodeIDs_;
+	}
 
-		writeCloudsAttributes();
-		writeLinesAttributes();
-		writeSurfacesAttributes();
-		writeVolumesAttributes();
+	keys.clear();
+	cellIDs.clear();
+	for(gmds::IGMesh::edge_iterator it = mesh_.edges_begin();!it.isDone();it.next()) {
+		Edge e = it.value();
+		e.getAllIDs<gmds::Node>(nodesIDs);
+		keys.push_back(getCentroidKey(mesh_,curve,nodesIDs));
+		cellIDs.push_back(e.getID());
+	}
+	buildRenumbering(keys,cellIDs,edgeOrder_,edgeIDs_);
 
-		writer_->close ( );
+	keys.clear();
+	cellIDs.clear();
+	for(gmds::IGMesh::face_iterator it = mesh_.faces_begin();!it.isDone();it.next()) {
+		Face f = it.value();
+		f.getAllIDs<gmds::Node>(nodesIDs);
+		keys.push_back(getCentroidKey(mesh_,curve,nodesIDs));
+		cellIDs.push_back(f.getID());
 	}
-	catch(Lima::write_erreur& e) {
-		std::cerr<<"GMDSCEA ERREUR LimaWriterAPI::write : "<<e.what()<<std::endl;
-		throw GMDSException(e.what());
+	buildRenumbering(keys,cellIDs,faceOrder_,faceIDs_);
+
+	keys.clear();
+	cellIDs.clear();
+	for(gmds::IGMesh::region_iterator it = mesh_.regions_begin();!it.isDone();it.next()) {
+		Region r = it.value();
+		r.getAllIDs<gmds::Node>(nodesIDs);
+		keys.push_back(getCentroidKey(mesh_,curve,nodesIDs));
+		cellIDs.push_back(r.getID());
 	}
+	buildRenumbering(keys,cellIDs,regionOrder_,regionIDs_);
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaWriterAPI::computeCompaction()
+{
+	buildCompaction(mesh_.nodes_begin(),nodeIDs_);
+	buildCompaction(mesh_.edges_begin(),edgeIDs_);
+	buildCompaction(mesh_.faces_begin(),faceIDs_);
+	buildCompaction(mesh_.regions_begin(),regionIDs_);
 }
 /*----------------------------------------------------------------------------*/
 void
 LimaWriterAPI::writeNodes()
 {
-	// check whether the ids are contiguous
+	// check whether the Lima ids are contiguous in writing order
 	bool isContiguous = true;
-	gmds::TCellID minID = gmds::NullID;
+	Lima::id_type minID = 0;
 	{
 		if(mesh_.getNbNodes() > 0) {
 
-			gmds::IGMesh::node_iterator it_nodes     = mesh_.nodes_begin();
-			gmds::TCellID currentID = it_nodes.value().getID();
-			minID = currentID+1; // +1 because mli ids begin at 1
+			CellTraversal<Node,gmds::IGMesh::node_iterator> it_nodes(mesh_,mesh_.nodes_begin(),nodeOrder_);
+			Lima::id_type currentID = nodeLimaID(it_nodes.value().getID());
+			minID = currentID;
 			it_nodes.next();
 			for(;!it_nodes.isDone();it_nodes.next()) {
-				Node n = it_nodes.value();
-				if(n.getID() != currentID+1) {
+				const Lima::id_type id = nodeLimaID(it_nodes.value().getID());
+				if(id != currentID+1) {
 					isContiguous = false;
 					break;
 				}
-				currentID = n.getID();
+				currentID = id;
 			}
 		}
 	}
 
-	try {
-		writer_->writeNodesInfo(isContiguous,mesh_.getNbNodes(),minID);
-	}
-	catch(Lima::write_erreur& e) {
-		std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-		throw GMDSException(e.what());
-	}
-
-	const Lima::id_type LimaWriterAPI_NBNODES_CHUNK = 10000;
-
-	double* xccords = new double[LimaWriterAPI_NBNODES_CHUNK];
-	double* yccords = new double[LimaWriterAPI_NBNODES_CHUNK];
-	double* zccords = new double[LimaWriterAPI_NBNODES_CHUNK];
-	Lima::id_type* ids = new Lima::id_type[LimaWriterAPI_NBNODES_CHUNK];
-
-	Lima::id_type chunkSize = 0;
+	chunks_.beginNodes(mesh_.getNbNodes(),isContiguous,minID);
 
-	gmds::IGMesh::node_iterator it_nodes     = mesh_.nodes_begin();
+	CellTraversal<Node,gmds::IGMesh::node_iterator> it_nodes(mesh_,mesh_.nodes_begin(),nodeOrder_);
 	for(;!it_nodes.isDone();it_nodes.next())
 	{
 		Node n = it_nodes.value();
-		xccords[chunkSize] = n.X();
-		yccords[chunkSize] = n.Y();
-		zccords[chunkSize] = n.Z();
-		ids[chunkSize] = n.getID()+1; // +1 because mli ids begin at 1
-
-		chunkSize++;
-		if(chunkSize==LimaWriterAPI_NBNODES_CHUNK) {
-			try {
-				writer_->writeNodes(chunkSize,xccords,yccords,zccords,ids);
-			}
-			catch(Lima::write_erreur& e) {
-				std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-				throw GMDSException(e.what());
-			}
-			chunkSize = 0;
-		}
+		chunks_.addNode(n.X(),n.Y(),n.Z(),nodeLimaID(n.getID()));
 	}
 
-	if(chunkSize>0) {
-		try {
-			writer_->writeNodes(chunkSize,xccords,yccords,zccords,ids);
-		}
-		catch(Lima::write_erreur& e) {
-			std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-			throw GMDSException(e.what());
-		}
-	}
-
-	delete[] xccords;
-	delete[] yccords;
-	delete[] zccords;
-	delete[] ids;
+	chunks_.endNodes();
 }
 /*----------------------------------------------------------------------------*/
 void
@@ -172,13 +483,17 @@ LimaWriterAPI::writeEdges()
 {
 	// check whether the ids are contiguous
 	bool isContiguous = true;
-	gmds::TCellID minID = gmds::NullID;
-	{
+	Lima::id_type minID = 0;
+	if(!edgeIDs_.empty()) {
+		// renumbered cells are numbered from 1 in writing order
+		minID = 1;
+	}
+	else {
 		if(mesh_.getNbEdges() > 0) {
 
 			gmds::IGMesh::edge_iterator it_edges     = mesh_.edges_begin();
 			gmds::TCellID currentID = it_edges.value().getID();
-			minID = currentID+1; // +1 because mli ids begin at 1
+			minID = toLimaID(currentID);
 			it_edges.next();
 			for(;!it_edges.isDone();it_edges.next()) {
 				Edge e = it_edges.value();
@@ -191,55 +506,21 @@ LimaWriterAPI::writeEdges()
 		}
 	}
 
-	try {
-		writer_->writeEdgesInfo(isContiguous,mesh_.getNbEdges(),minID);
-	}
-	catch(Lima::write_erreur& e) {
-		std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-		throw GMDSException(e.what());
-	}
-
-	const Lima::id_type LimaWriterAPI_NBEDGES_CHUNK = 10000;
+	chunks_.beginCells(1,mesh_.getNbEdges(),isContiguous,minID,2);
 
-	Lima::id_type* edge2nodeIDs = new Lima::id_type[2*LimaWriterAPI_NBEDGES_CHUNK];
-	Lima::id_type* ids= new Lima::id_type[LimaWriterAPI_NBEDGES_CHUNK];
+	std::vector<gmds::TCellID> nodesIDs;
 
-	Lima::id_type chunkSize = 0;
-
-	gmds::IGMesh::edge_iterator it_edges     = mesh_.edges_begin();
+	CellTraversal<Edge,gmds::IGMesh::edge_iterator> it_edges(mesh_,mesh_.edges_begin(),edgeOrder_);
 	for(;!it_edges.isDone();it_edges.next())
 	{
 		Edge e = it_edges.value();
-		std::vector<gmds::TCellID> nodesIDs = e.getAllIDs<gmds::Node>();
-		edge2nodeIDs[2*chunkSize  ] = nodesIDs[0]+1;
-		edge2nodeIDs[2*chunkSize+1] = nodesIDs[1]+1;
-		ids[chunkSize] = e.getID()+1;
-
-		chunkSize++;
-		if(chunkSize==LimaWriterAPI_NBEDGES_CHUNK) {
-			try {
-				writer_->writeEdges(chunkSize,edge2nodeIDs,ids);
-			}
-			catch(Lima::write_erreur& e) {
-				std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-				throw GMDSException(e.what());
-			}
-			chunkSize = 0;
-		}
+		e.getAllIDs<gmds::Node>(nodesIDs);
+		Lima::id_type* edge2nodes = chunks_.addCell(edgeLimaID(e.getID()),2);
+		edge2nodes[0] = nodeLimaID(nodesIDs[0]);
+		edge2nodes[1] = nodeLimaID(nodesIDs[1]);
 	}
 
-	if(chunkSize>0) {
-		try {
-			writer_->writeEdges(chunkSize,edge2nodeIDs,ids);
-		}
-		catch(Lima::write_erreur& e) {
-			std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-			throw GMDSException(e.what());
-		}
-	}
-
-	delete[] edge2nodeIDs;
-	delete[] ids;
+	chunks_.endCells();
 }
 /*----------------------------------------------------------------------------*/
 void
@@ -247,13 +528,17 @@ LimaWriterAPI::writeFaces()
 {
 	// check whether the ids are contiguous
 	bool isContiguous = true;
-	gmds::TCellID minID = gmds::NullID;
-	{
+	Lima::id_type minID = 0;
+	if(!faceIDs_.empty()) {
+		// renumbered cells are numbered from 1 in writing order
+		minID = 1;
+	}
+	else {
 		if(mesh_.getNbFaces() > 0) {
 
 			gmds::IGMesh::face_iterator it_faces     = mesh_.faces_begin();
 			gmds::TCellID currentID = it_faces.value().getID();
-			minID = currentID+1; // +1 because mli ids begin at 1
+			minID = toLimaID(currentID);
 			it_faces.next();
 			for(;!it_faces.isDone();it_faces.next()) {
 				Face f = it_faces.value();
@@ -266,69 +551,36 @@ LimaWriterAPI::writeFaces()
 		}
 	}
 
-	try {
-		writer_->writeFacesInfo(isContiguous,mesh_.getNbFaces(),minID);
-	}
-	catch(Lima::write_erreur& e) {
-		std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-		throw GMDSException(e.what());
-	}
-
-	const Lima::id_type LimaWriterAPI_NBFACES_CHUNK = 10000;
-	const Lima::id_type LimaWriterAPI_MAX_NBNODES_PER_FACE = 15; //Lima::MAX_NOEUDS;
+	// the connectivity buffer is sized for the largest face
+	chunks_.beginCells(2,mesh_.getNbFaces(),isContiguous,minID,
+			(facesNbNodes_ != 0)?facesNbNodes_:15); //Lima::MAX_NOEUDS;
 
-	Lima::id_type* face2nodeIDs = new Lima::id_type[LimaWriterAPI_MAX_NBNODES_PER_FACE*LimaWriterAPI_NBFACES_CHUNK];
-	Lima::id_type* nbNodesPerFace = new Lima::id_type[LimaWriterAPI_NBFACES_CHUNK];
-	Lima::id_type* ids = new Lima::id_type[LimaWriterAPI_NBFACES_CHUNK];
+	switch(facesNbNodes_) {
+	case 3 :
+		writeFacesFixed<3>();
+		return;
+	case 4 :
+		writeFacesFixed<4>();
+		return;
+	default:
+		break;
+	}
 
-	Lima::id_type chunkSize = 0;
-	Lima::id_type currentIndex = 0;
+	std::vector<gmds::TCellID> nodesIDs;
 
-	gmds::IGMesh::face_iterator it_faces     = mesh_.faces_begin();
+	CellTraversal<Face,gmds::IGMesh::face_iterator> it_faces(mesh_,mesh_.faces_begin(),faceOrder_);
 	for(;!it_faces.isDone();it_faces.next())
 	{
 		Face f = it_faces.value();
-		std::vector<gmds::TCellID> nodesIDs = f.getAllIDs<gmds::Node>();
-		nbNodesPerFace[chunkSize] = nodesIDs.size();
-
-		if(nodesIDs.size() > LimaWriterAPI_MAX_NBNODES_PER_FACE) {
-			throw GMDSException("LimaWriterAPI::writeFaces a face has too many nodes (> 15 == Lima::MAX_NOEUDS).");
-		}
+		f.getAllIDs<gmds::Node>(nodesIDs);
 
-		for(int i = 0; i<nodesIDs.size(); i++) {
-			face2nodeIDs[currentIndex] = nodesIDs[i]+1;
-			currentIndex++;
-		}
-
-		ids[chunkSize] = f.getID()+1;
-
-		chunkSize++;
-		if(chunkSize==LimaWriterAPI_NBFACES_CHUNK) {
-			try {
-				writer_->writeFaces(chunkSize,face2nodeIDs,nbNodesPerFace,ids);
-			}
-			catch(Lima::write_erreur& e) {
-				std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-				throw GMDSException(e.what());
-			}
-			chunkSize = 0;
-			currentIndex = 0;
+		Lima::id_type* face2nodes = chunks_.addCell(faceLimaID(f.getID()),nodesIDs.size());
+		for(std::size_t i = 0; i<nodesIDs.size(); i++) {
+			face2nodes[i] = nodeLimaID(nodesIDs[i]);
 		}
 	}
 
-	if(chunkSize>0) {
-		try {
-			writer_->writeFaces(chunkSize,face2nodeIDs,nbNodesPerFace,ids);
-		}
-		catch(Lima::write_erreur& e) {
-			std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-			throw GMDSException(e.what());
-		}
-	}
-
-	delete[] face2nodeIDs;
-	delete[] nbNodesPerFace;
-	delete[] ids;
+	chunks_.endCells();
 }
 /*----------------------------------------------------------------------------*/
 void
@@ -336,13 +588,17 @@ LimaWriterAPI::writeRegions()
 {
 	// check whether the ids are contiguous
 	bool isContiguous = true;
-	gmds::TCellID minID = gmds::NullID;
-	{
+	Lima::id_type minID = 0;
+	if(!regionIDs_.empty()) {
+		// renumbered cells are numbered from 1 in writing order
+		minID = 1;
+	}
+	else {
 		if(mesh_.getNbRegions() > 0) {
 
 			gmds::IGMesh::region_iterator it_regions     = mesh_.regions_begin();
 			gmds::TCellID currentID = it_regions.value().getID();
-			minID = currentID+1; // +1 because mli ids begin at 1
+			minID = toLimaID(currentID);
 			it_regions.next();
 			for(;!it_regions.isDone();it_regions.next()) {
 				Region r = it_regions.value();
@@ -355,92 +611,183 @@ LimaWriterAPI::writeRegions()
 		}
 	}
 
-	try {
-		writer_->writeRegionsInfo(isContiguous,mesh_.getNbRegions(),minID);
-	}
-	catch(Lima::write_erreur& e) {
-		std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-		throw GMDSException(e.what());
-	}
+	// the connectivity buffer is sized for the largest region
+	chunks_.beginCells(3,mesh_.getNbRegions(),isContiguous,minID,
+			(regionsNbNodes_ != 0)?regionsNbNodes_:15); //Lima::MAX_NOEUDS;
 
-	const Lima::id_type LimaWriterAPI_NBREGIONS_CHUNK = 10000;
-	const Lima::id_type LimaWriterAPI_MAX_NBNODES_PER_REGION = 15; //Lima::MAX_NOEUDS;
-
-	Lima::id_type* region2nodeIDs = new Lima::id_type[LimaWriterAPI_MAX_NBNODES_PER_REGION*LimaWriterAPI_NBREGIONS_CHUNK];
-	Lima::Polyedre::PolyedreType* regionTypes = new Lima::Polyedre::PolyedreType[LimaWriterAPI_NBREGIONS_CHUNK];
-	Lima::id_type* ids = new Lima::id_type[LimaWriterAPI_NBREGIONS_CHUNK];
+	switch(regionsNbNodes_) {
+	case 4 :
+		writeRegionsFixed<4>();
+		return;
+	case 5 :
+		writeRegionsFixed<5>();
+		return;
+	case 6 :
+		writeRegionsFixed<6>();
+		return;
+	case 8 :
+		writeRegionsFixed<8>();
+		return;
+	default:
+		break;
+	}
 
-	Lima::id_type chunkSize = 0;
-	Lima::id_type currentIndex = 0;
+	std::vector<gmds::TCellID> nodesIDs;
 
-	gmds::IGMesh::region_iterator it_regions     = mesh_.regions_begin();
+	CellTraversal<Region,gmds::IGMesh::region_iterator> it_regions(mesh_,mesh_.regions_begin(),regionOrder_);
 	for(;!it_regions.isDone();it_regions.next())
 	{
 		Region r = it_regions.value();
-		std::vector<gmds::TCellID> nodesIDs = r.getAllIDs<gmds::Node>();
-
-		switch(r.getType()) {
-		case gmds::GMDS_TETRA :
-			regionTypes[chunkSize] = Lima::Polyedre::TETRAEDRE;
-			break;
-		case gmds::GMDS_PYRAMID :
-			regionTypes[chunkSize] = Lima::Polyedre::PYRAMIDE;
-			break;
-		case gmds::GMDS_PRISM3 :
-			regionTypes[chunkSize] = Lima::Polyedre::PRISME;
-			break;
-		case gmds::GMDS_HEX :
-			regionTypes[chunkSize] = Lima::Polyedre::HEXAEDRE;
-			break;
-		default:
-			throw GMDSException("LimaWriterAPI::writeRegions cell type not handled by Lima.");
+		r.getAllIDs<gmds::Node>(nodesIDs);
+
+		Lima::id_type* region2nodes = chunks_.addCell(regionLimaID(r.getID()),nodesIDs.size(),
+				getLimaRegionType(r.getType()));
+		for(std::size_t i = 0; i<nodesIDs.size(); i++) {
+			region2nodes[i] = nodeLimaID(nodesIDs[i]);
 		}
+	}
 
-		if(nodesIDs.size() > LimaWriterAPI_MAX_NBNODES_PER_REGION) {
-			throw GMDSException("LimaWriterAPI::writeRegions a face has too many nodes (> 15 == Lima::MAX_NOEUDS).");
+	chunks_.endCells();
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaWriterAPI::detectFacesType()
+{
+	facesNbNodes_ = 0;
+
+	if(mesh_.getNbFaces() == 0) {
+		return;
+	}
+
+	// the type histogram of the statistics is computed in the same pass
+	gmds::IGMesh::face_iterator it_faces = mesh_.faces_begin();
+	const gmds::ECellType type = it_faces.value().getType();
+	bool isUniform = true;
+	gmds::ECellType current = type;
+	std::size_t nbCurrent = 0;
+	for(;!it_faces.isDone();it_faces.next()) {
+		const gmds::ECellType t = it_faces.value().getType();
+		if(t != current) {
+			chunks_.addCellType(current,nbCurrent);
+			current = t;
+			nbCurrent = 0;
+			isUniform = false;
 		}
+		nbCurrent++;
+	}
+	chunks_.addCellType(current,nbCurrent);
+	if(!isUniform) {
+		return;
+	}
 
-		for(int i = 0; i<nodesIDs.size(); i++) {
-			region2nodeIDs[currentIndex] = nodesIDs[i]+1;
-			currentIndex++;
+	switch(type) {
+	case gmds::GMDS_TRIANGLE :
+		facesNbNodes_ = 3;
+		break;
+	case gmds::GMDS_QUAD :
+		facesNbNodes_ = 4;
+		break;
+	default:
+		// polygons may have any number of nodes, the generic path is used
+		break;
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+LimaWriterAPI::detectRegionsType()
+{
+	regionsNbNodes_ = 0;
+
+	if(mesh_.getNbRegions() == 0) {
+		return;
+	}
+
+	// the type histogram of the statistics is computed in the same pass
+	gmds::IGMesh::region_iterator it_regions = mesh_.regions_begin();
+	const gmds::ECellType type = it_regions.value().getType();
+	bool isUniform = true;
+	gmds::ECellType current = type;
+	std::size_t nbCurrent = 0;
+	for(;!it_regions.isDone();it_regions.next()) {
+		const gmds::ECellType t = it_regions.value().getType();
+		if(t != current) {
+			chunks_.addCellType(current,nbCurrent);
+			current = t;
+			nbCurrent = 0;
+			isUniform = false;
 		}
+		nbCurrent++;
+	}
+	chunks_.addCellType(current,nbCurrent);
+	if(!isUniform) {
+		return;
+	}
+
+	switch(type) {
+	case gmds::GMDS_TETRA :
+		regionsNbNodes_ = 4;
+		break;
+	case gmds::GMDS_PYRAMID :
+		regionsNbNodes_ = 5;
+		break;
+	case gmds::GMDS_PRISM3 :
+		regionsNbNodes_ = 6;
+		break;
+	case gmds::GMDS_HEX :
+		regionsNbNodes_ = 8;
+		break;
+	default:
+		// not handled by Lima, the generic path will raise the error
+		return;
+	}
+	regionsType_ = getLimaRegionType(type);
+}
+/*----------------------------------------------------------------------------*/
+template<int TNbNodes>
+void
+LimaWriterAPI::writeFacesFixed()
+{
+	std::vector<gmds::TCellID> nodesIDs;
 
-		ids[chunkSize] = r.getID()+1;
+	CellTraversal<Face,gmds::IGMesh::face_iterator> it_faces(mesh_,mesh_.faces_begin(),faceOrder_);
+	for(;!it_faces.isDone();it_faces.next())
+	{
+		Face f = it_faces.value();
+		f.getAllIDs<gmds::Node>(nodesIDs);
 
-		chunkSize++;
-		if(chunkSize==LimaWriterAPI_NBREGIONS_CHUNK) {
-			try {
-				writer_->writeRegions(chunkSize,region2nodeIDs,regionTypes,ids);
-			}
-			catch(Lima::write_erreur& e) {
-				std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-				throw GMDSException(e.what());
-			}
-			chunkSize = 0;
-			currentIndex = 0;
+		Lima::id_type* face2nodes = chunks_.addCell(faceLimaID(f.getID()),TNbNodes);
+		for(int i = 0; i<TNbNodes; i++) {
+			face2nodes[i] = nodeLimaID(nodesIDs[i]);
 		}
 	}
 
-	if(chunkSize>0) {
-		try {
-			writer_->writeRegions(chunkSize,region2nodeIDs,regionTypes,ids);
-		}
-		catch(Lima::write_erreur& e) {
-			std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-			throw GMDSException(e.what());
+	chunks_.endCells();
+}
+/*----------------------------------------------------------------------------*/
+template<int TNbNodes>
+void
+LimaWriterAPI::writeRegionsFixed()
+{
+	std::vector<gmds::TCellID> nodesIDs;
+
+	CellTraversal<Region,gmds::IGMesh::region_iterator> it_regions(mesh_,mesh_.regions_begin(),regionOrder_);
+	for(;!it_regions.isDone();it_regions.next())
+	{
+		Region r = it_regions.value();
+		r.getAllIDs<gmds::Node>(nodesIDs);
+
+		Lima::id_type* region2nodes = chunks_.addCell(regionLimaID(r.getID()),TNbNodes,regionsType_);
+		for(int i = 0; i<TNbNodes; i++) {
+			region2nodes[i] = nodeLimaID(nodesIDs[i]);
 		}
 	}
 
-	delete[] region2nodeIDs;
-	delete[] regionTypes;
-	delete[] ids;
+	chunks_.endCells();
 }
 /*----------------------------------------------------------------------------*/
 void
 LimaWriterAPI::writeClouds()
 {
-	const Lima::id_type LimaWriterAPI_NBNODES_CHUNK = 10000;
-
 	std::vector<std::string> names;
 	std::vector<Lima::id_type> sizes;
 
@@ -450,59 +797,24 @@ LimaWriterAPI::writeClouds()
 		sizes.push_back(cl.size());
 	}
 
-	Lima::id_type nbClouds = mesh_.getNbClouds();
-
-	try {
-		writer_->writeNodeSetInfo(nbClouds,names,sizes);
-	}
-	catch(Lima::write_erreur& e) {
-		std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-		throw GMDSException(e.what());
-	}
-
-	Lima::id_type ids[LimaWriterAPI_NBNODES_CHUNK];
-	Lima::id_type chunkSize = 0;
+	chunks_.beginGroups(0,names,sizes);
 
 	for(int i=0; i<mesh_.getNbClouds(); i++) {
 		gmds::IGMesh::cloud& cl = mesh_.getCloud(i);
+		chunks_.beginGroup(cl.name());
 
 		std::vector<gmds::TCellID> nodeIDs= cl.cellIDs();
-
-		for(int iNode=0; iNode<nodeIDs.size(); iNode++) {
-			ids[chunkSize] = nodeIDs[iNode]+1;
-			chunkSize++;
-
-			if(chunkSize==LimaWriterAPI_NBNODES_CHUNK) {
-				try {
-					writer_->writeNodeSetData(cl.name(),chunkSize,ids);
-				}
-				catch(Lima::write_erreur& e) {
-					std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-					throw GMDSException(e.what());
-				}
-				chunkSize = 0;
-			}
-		}
-
-		if(chunkSize > 0) {
-			try {
-				writer_->writeNodeSetData(cl.name(),chunkSize,ids);
-			}
-			catch(Lima::write_erreur& e) {
-				std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-				throw GMDSException(e.what());
-			}
-			chunkSize = 0;
+		for(std::size_t iNode=0; iNode<nodeIDs.size(); iNode++) {
+			chunks_.addGroupCell(nodeLimaID(nodeIDs[iNode]));
 		}
 
+		chunks_.endGroup();
 	}
 }
 /*----------------------------------------------------------------------------*/
 void
 LimaWriterAPI::writeLines()
 {
-	const Lima::id_type LimaWriterAPI_NBEDGES_CHUNK = 10000;
-
 	std::vector<std::string> names;
 	std::vector<Lima::id_type> sizes;
 
@@ -512,59 +824,24 @@ LimaWriterAPI::writeLines()
 		sizes.push_back(l.size());
 	}
 
-	Lima::id_type nbLines = mesh_.getNbLines();
-
-	try {
-		writer_->writeEdgeSetInfo(nbLines,names,sizes);
-	}
-	catch(Lima::write_erreur& e) {
-		std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-		throw GMDSException(e.what());
-	}
-
-	Lima::id_type ids[LimaWriterAPI_NBEDGES_CHUNK];
-	Lima::id_type chunkSize = 0;
+	chunks_.beginGroups(1,names,sizes);
 
 	for(int i=0; i<mesh_.getNbLines(); i++) {
 		gmds::IGMesh::line& l = mesh_.getLine(i);
+		chunks_.beginGroup(l.name());
 
 		std::vector<gmds::TCellID> edgeIDs= l.cellIDs();
-
-		for(int iEdge=0; iEdge<edgeIDs.size(); iEdge++) {
-			ids[chunkSize] = edgeIDs[iEdge]+1;
-			chunkSize++;
-
-			if(chunkSize==LimaWriterAPI_NBEDGES_CHUNK) {
-				try {
-					writer_->writeEdgeSetData(l.name(),chunkSize,ids);
-				}
-				catch(Lima::write_erreur& e) {
-					std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-					throw GMDSException(e.what());
-				}
-				chunkSize = 0;
-			}
-		}
-
-		if(chunkSize > 0) {
-			try {
-				writer_->writeEdgeSetData(l.name(),chunkSize,ids);
-			}
-			catch(Lima::write_erreur& e) {
-				std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-				throw GMDSException(e.what());
-			}
-			chunkSize = 0;
+		for(std::size_t iEdge=0; iEdge<edgeIDs.size(); iEdge++) {
+			chunks_.addGroupCell(edgeLimaID(edgeIDs[iEdge]));
 		}
 
+		chunks_.endGroup();
 	}
 }
 /*----------------------------------------------------------------------------*/
 void
 LimaWriterAPI::writeSurfaces()
 {
-	const Lima::id_type LimaWriterAPI_NBFACES_CHUNK = 10000;
-
 	std::vector<std::string> names;
 	std::vector<Lima::id_type> sizes;
 
@@ -574,61 +851,27 @@ LimaWriterAPI::writeSurfaces()
 		sizes.push_back(surf.size());
 	}
 
-	Lima::id_type nbSurfaces = mesh_.getNbSurfaces();
-
-	try {
-		writer_->writeFaceSetInfo(nbSurfaces,names,sizes);
-	}
-	catch(Lima::write_erreur& e) {
-		std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-		throw GMDSException(e.what());
-	}
-
-	Lima::id_type ids[LimaWriterAPI_NBFACES_CHUNK];
-	Lima::id_type nbNodes[LimaWriterAPI_NBFACES_CHUNK];
-	Lima::id_type chunkSize = 0;
+	chunks_.beginGroups(2,names,sizes);
 
 	for(int i=0; i<mesh_.getNbSurfaces(); i++) {
 		gmds::IGMesh::surface& surf = mesh_.getSurface(i);
+		chunks_.beginGroup(surf.name());
 
 		std::vector<gmds::TCellID> faceIDs= surf.cellIDs();
-
-		for(int iFace=0; iFace<faceIDs.size(); iFace++) {
-			ids[chunkSize] = faceIDs[iFace]+1;
-			nbNodes[chunkSize] = (mesh_.get<gmds::Face> (faceIDs[iFace])).getNbNodes();
-			chunkSize++;
-
-			if(chunkSize==LimaWriterAPI_NBFACES_CHUNK) {
-				try {
-					writer_->writeFaceSetData(surf.name(),chunkSize,ids,nbNodes);
-				}
-				catch(Lima::write_erreur& e) {
-					std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-					throw GMDSException(e.what());
-				}
-				chunkSize = 0;
-			}
-		}
-
-		if(chunkSize > 0) {
-			try {
-				writer_->writeFaceSetData(surf.name(),chunkSize,ids,nbNodes);
-			}
-			catch(Lima::write_erreur& e) {
-				std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-				throw GMDSException(e.what());
-			}
-			chunkSize = 0;
+		for(std::size_t iFace=0; iFace<faceIDs.size(); iFace++) {
+			// all the faces have the same number of nodes if facesNbNodes_ != 0
+			const Lima::id_type nbNodes = (facesNbNodes_ != 0)?facesNbNodes_:
+					(mesh_.get<gmds::Face> (faceIDs[iFace])).getNbNodes();
+			chunks_.addGroupCell(faceLimaID(faceIDs[iFace]),nbNodes);
 		}
 
+		chunks_.endGroup();
 	}
 }
 /*----------------------------------------------------------------------------*/
 void
 LimaWriterAPI::writeVolumes()
 {
-	const Lima::id_type LimaWriterAPI_NBREGIONS_CHUNK = 10000;
-
 	std::vector<std::string> names;
 	std::vector<Lima::id_type> sizes;
 
@@ -638,118 +881,24 @@ LimaWriterAPI::writeVolumes()
 		sizes.push_back(vol.size());
 	}
 
-	Lima::id_type nbVolumes = mesh_.getNbVolumes();
-
-	try {
-		writer_->writeRegionSetInfo(nbVolumes,names,sizes);
-	}
-	catch(Lima::write_erreur& e) {
-		std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-		throw GMDSException(e.what());
-	}
-
-	Lima::id_type ids[LimaWriterAPI_NBREGIONS_CHUNK];
-	Lima::Polyedre::PolyedreType types[LimaWriterAPI_NBREGIONS_CHUNK];
-	Lima::id_type chunkSize = 0;
+	chunks_.beginGroups(3,names,sizes);
 
 	for(int i=0; i<mesh_.getNbVolumes(); i++) {
 		gmds::IGMesh::volume& vol = mesh_.getVolume(i);
+		chunks_.beginGroup(vol.name());
 
 		std::vector<gmds::TCellID> regionIDs= vol.cellIDs();
-
-		for(int iRegion=0; iRegion<regionIDs.size(); iRegion++) {
-			ids[chunkSize] = regionIDs[iRegion]+1;
-			switch((mesh_.get<gmds::Region>(regionIDs[iRegion])).getType()) {
-			case gmds::GMDS_TETRA :
-				types[chunkSize] = Lima::Polyedre::TETRAEDRE;
-				break;
-			case gmds::GMDS_PYRAMID :
-				types[chunkSize] = Lima::Polyedre::PYRAMIDE;
-				break;
-			case gmds::GMDS_PRISM3 :
-				types[chunkSize] = Lima::Polyedre::PRISME;
-				break;
-			case gmds::GMDS_HEX :
-				types[chunkSize] = Lima::Polyedre::HEXAEDRE;
-				break;
-			default:
-				throw GMDSException("LimaWriterAPI::writeRegions cell type not handled by Lima.");
-			}
-			chunkSize++;
-
-			if(chunkSize==LimaWriterAPI_NBREGIONS_CHUNK) {
-				try {
-					writer_->writeRegionSetData(vol.name(),chunkSize,ids,types);
-				}
-				catch(Lima::write_erreur& e) {
-					std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-					throw GMDSException(e.what());
-				}
-				chunkSize = 0;
-			}
-		}
-
-		if(chunkSize > 0) {
-			try {
-				writer_->writeRegionSetData(vol.name(),chunkSize,ids,types);
-			}
-			catch(Lima::write_erreur& e) {
-				std::cerr<<"GMDSCEA ERREUR : "<<e.what()<<std::endl;
-				throw GMDSException(e.what());
-			}
-			chunkSize = 0;
+		for(std::size_t iRegion=0; iRegion<regionIDs.size(); iRegion++) {
+			// all the regions have the same type if regionsNbNodes_ != 0,
+			// no need to look at each of them
+			const Lima::Polyedre::PolyedreType type = (regionsNbNodes_ != 0)?regionsType_:
+					getLimaRegionType((mesh_.get<gmds::Region>(regionIDs[iRegion])).getType());
+			chunks_.addGroupCell(regionLimaID(regionIDs[iRegion]),0,type);
 		}
 
+		chunks_.endGroup();
 	}
 }
 /*----------------------------------------------------------------------------*/
-void
-LimaWriterAPI::writeNodesAttributes()
-{
-	writer_->writeNodeAttributes();
-}
-/*----------------------------------------------------------------------------*/
-void
-LimaWriterAPI::writeEdgesAttributes()
-{
-	writer_->writeEdgeAttributes();
-}
-/*----------------------------------------------------------------------------*/
-void
-LimaWriterAPI::writeFacesAttributes()
-{
-	writer_->writeFaceAttributes();
-}
-/*----------------------------------------------------------------------------*/
-void
-LimaWriterAPI::writeRegionsAttributes()
-{
-	writer_->writeRegionAttributes();
-}
-/*----------------------------------------------------------------------------*/
-void
-LimaWriterAPI::writeCloudsAttributes()
-{
-	writer_->writeNodeSetsAttributes();
-}
-/*----------------------------------------------------------------------------*/
-void
-LimaWriterAPI::writeLinesAttributes()
-{
-	writer_->writeEdgeSetsAttributes();
-}
-/*----------------------------------------------------------------------------*/
-void
-LimaWriterAPI::writeSurfacesAttributes()
-{
-	writer_->writeFaceSetsAttributes();
-}
-/*----------------------------------------------------------------------------*/
-void
-LimaWriterAPI::writeVolumesAttributes()
-{
-	writer_->writeRegionSetsAttributes();
-}
-/*----------------------------------------------------------------------------*/
 }  // namespace gmds
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,244 @@
+/*----------------------------------------------------------------------------*/
+/** \file    MeshHash.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/MeshHash.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+uint64_t coordBits(const double AValue)
+{
+	uint64_t bits;
+	std::memcpy(&bits,&AValue,sizeof(bits));
+	return bits;
+}
+/*----------------------------------------------------------------------------*/
+uint64_t stringHash(const std::string& AString)
+{
+	uint64_t h = AString.size();
+	for(std::size_t i=0; i<AString.size(); i++) {
+		h = MeshHash::combine(h,static_cast<unsigned char>(AString[i]));
+	}
+	return h;
+}
+/*----------------------------------------------------------------------------*/
+template<typename TGroup>
+uint64_t groupHash(uint64_t AHash, TGroup& AGroup)
+{
+	AHash = MeshHash::combine(AHash,stringHash(AGroup.name()));
+	std::vector<gmds::TCellID> ids = AGroup.cellIDs();
+	AHash = MeshHash::combine(AHash,ids.size());
+	for(std::size_t i=0; i<ids.size(); i++) {
+		AHash = MeshHash::combine(AHash,ids[i]);
+	}
+	return AHash;
+}
+/*----------------------------------------------------------------------------*/
+template<typename TIterator>
+void collectIDs(TIterator AIt, std::vector<gmds::TCellID>& AIDs)
+{
+	for(;!AIt.isDone();AIt.next()) {
+		AIDs.push_back(AIt.value().getID());
+	}
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+MeshHash::MeshHash(const gmds::IGMesh& AMesh)
+:mesh_(AMesh),nbThreads_(0)
+{
+
+}
+/*----------------------------------------------------------------------------*/
+void
+MeshHash::setNbThreads(int ANbThreads)
+{
+	nbThreads_ = ANbThreads;
+}
+/*----------------------------------------------------------------------------*/
+uint64_t
+MeshHash::combine(uint64_t AHash, uint64_t AValue)
+{
+	// one round of the xxhash64 accumulator
+	const uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+	const uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+	AHash += AValue*prime2;
+	AHash = (AHash<<31) | (AHash>>33);
+	return AHash*prime1;
+}
+/*----------------------------------------------------------------------------*/
+std::string
+MeshHash::toString(uint64_t AHash)
+{
+	char buf[17];
+	std::snprintf(buf,sizeof(buf),"%016llx",static_cast<unsigned long long>(AHash));
+	return buf;
+}
+/*----------------------------------------------------------------------------*/
+uint64_t
+MeshHash::fromString(const std::string& AString)
+{
+	return std::strtoull(AString.c_str(),0,16);
+}
+/*----------------------------------------------------------------------------*/
+uint64_t
+MeshHash::compute(gmds::MeshModel AModel)
+{
+	// the mesh is not modified while hashing, so the iterators and the
+	// accessors can be shared by the threads
+	gmds::IGMesh& mesh = const_cast<gmds::IGMesh&>(mesh_);
+
+	uint64_t h = combine(0,mesh.getDim());
+	std::vector<gmds::TCellID> ids;
+
+	if(AModel.has(N)) {
+		ids.clear();
+		collectIDs(mesh.nodes_begin(),ids);
+		h = combine(h,hashCells(0,ids));
+	}
+	if(AModel.has(E)) {
+		ids.clear();
+		collectIDs(mesh.edges_begin(),ids);
+		h = combine(h,hashCells(1,ids));
+	}
+	if(AModel.has(F)) {
+		ids.clear();
+		collectIDs(mesh.faces_begin(),ids);
+		h = combine(h,hashCells(2,ids));
+	}
+	if(AModel.has(R)) {
+		ids.clear();
+		collectIDs(mesh.regions_begin(),ids);
+		h = combine(h,hashCells(3,ids));
+	}
+
+	if(AModel.has(N)) {
+		for(gmds::IGMesh::clouds_iterator it = mesh.clouds_begin(); it != mesh.clouds_end(); ++it) {
+			h = groupHash(h,*it);
+		}
+	}
+	if(AModel.has(E)) {
+		for(gmds::IGMesh::lines_iterator it = mesh.lines_begin(); it != mesh.lines_end(); ++it) {
+			h = groupHash(h,*it);
+		}
+	}
+	if(AModel.has(F)) {
+		for(gmds::IGMesh::surfaces_iterator it = mesh.surfaces_begin(); it != mesh.surfaces_end(); ++it) {
+			h = groupHash(h,*it);
+		}
+	}
+	if(AModel.has(R)) {
+		for(gmds::IGMesh::volumes_iterator it = mesh.volumes_begin(); it != mesh.volumes_end(); ++it) {
+			h = groupHash(h,*it);
+		}
+	}
+
+	// final avalanche
+	h ^= h>>33;
+	h *= 0xC2B2AE3D27D4EB4FULL;
+	h ^= h>>29;
+	h *= 0x165667B19E3779F9ULL;
+	h ^= h>>32;
+	return h;
+}
+/*----------------------------------------------------------------------------*/
+uint64_t
+MeshHash::hashCells(int ADim, const std::vector<gmds::TCellID>& AIDs)
+{
+	const std::size_t nbBlocks = (AIDs.size()+BLOCK_SIZE-1)/BLOCK_SIZE;
+	std::vector<uint64_t> blocks(nbBlocks,0);
+
+	int nbThreads = nbThreads_;
+	if(nbThreads <= 0) {
+		nbThreads = std::thread::hardware_concurrency();
+	}
+	if(nbThreads <= 0) {
+		nbThreads = 1;
+	}
+	if(static_cast<std::size_t>(nbThreads) > nbBlocks) {
+		nbThreads = nbBlocks;
+	}
+
+	if(nbThreads <= 1) {
+		for(std::size_t b=0; b<nbBlocks; b++) {
+			blocks[b] = hashBlock(ADim,AIDs,b*BLOCK_SIZE,std::min((b+1)*BLOCK_SIZE,AIDs.size()));
+		}
+	}
+	else {
+		// thread t hashes the blocks t, t+nbThreads...
+		std::vector<std::thread> threads;
+		for(int t=0; t<nbThreads; t++) {
+			threads.push_back(std::thread([&,t]() {
+				for(std::size_t b=t; b<nbBlocks; b+=nbThreads) {
+					blocks[b] = hashBlock(ADim,AIDs,b*BLOCK_SIZE,std::min((b+1)*BLOCK_SIZE,AIDs.size()));
+				}
+			}));
+		}
+		for(std::size_t t=0; t<threads.size(); t++) {
+			threads[t].join();
+		}
+	}
+
+	uint64_t h = combine(ADim,AIDs.size());
+	for(std::size_t b=0; b<nbBlocks; b++) {
+		h = combine(h,blocks[b]);
+	}
+	return h;
+}
+/*----------------------------------------------------------------------------*/
+uint64_t
+MeshHash::hashBlock(int ADim, const std::vector<gmds::TCellID>& AIDs,
+		std::size_t AFirst, std::size_t ALast) const
+{
+	uint64_t h = AFirst;
+	std::vector<gmds::TCellID> nodes;
+	for(std::size_t i=AFirst; i<ALast; i++) {
+		const gmds::TCellID id = AIDs[i];
+		h = combine(h,id);
+		switch(ADim) {
+		case 0 :
+		{
+			Node n = mesh_.get<Node>(id);
+			h = combine(h,coordBits(n.X()));
+			h = combine(h,coordBits(n.Y()));
+			h = combine(h,coordBits(n.Z()));
+			continue;
+		}
+		case 1 :
+			mesh_.get<Edge>(id).getAllIDs<Node>(nodes);
+			break;
+		case 2 :
+		{
+			Face f = mesh_.get<Face>(id);
+			h = combine(h,f.getType());
+			f.getAllIDs<Node>(nodes);
+		}
+			break;
+		default :
+		{
+			Region r = mesh_.get<Region>(id);
+			h = combine(h,r.getType());
+			r.getAllIDs<Node>(nodes);
+		}
+			break;
+		}
+		h = combine(h,nodes.size());
+		for(std::size_t k=0; k<nodes.size(); k++) {
+			h = combine(h,nodes[k]);
+		}
+	}
+	return h;
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,327 @@
+/*----------------------------------------------------------------------------*/
+/** \file    MeshStatistics.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/MeshStatistics.h"
+/*----------------------------------------------------------------------------*/
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/LimaMetaFile.h"
+#include "GMDSCEA/MeshHash.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+const gmds::ECellType knownTypes[] = {GMDS_EDGE, GMDS_TRIANGLE, GMDS_QUAD,
+		GMDS_POLYGON, GMDS_TETRA, GMDS_HEX, GMDS_PYRAMID, GMDS_PRISM3};
+const char* knownTypeNames[] = {"edge", "triangle", "quad", "polygon",
+		"tetra", "hex", "pyramid", "prism3"};
+const int nbKnownTypes = sizeof(knownTypes)/sizeof(knownTypes[0]);
+/*----------------------------------------------------------------------------*/
+const char* dimNames[] = {"nodes", "edges", "faces", "regions"};
+/*----------------------------------------------------------------------------*/
+uint64_t coordBits(const double AValue)
+{
+	uint64_t bits;
+	std::memcpy(&bits,&AValue,sizeof(bits));
+	return bits;
+}
+/*----------------------------------------------------------------------------*/
+template<typename T>
+std::string toString(const T& AValue)
+{
+	std::ostringstream s;
+	s.precision(17);
+	s<<AValue;
+	return s.str();
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+MeshStatistics::MeshStatistics()
+{
+	clear();
+}
+/*----------------------------------------------------------------------------*/
+void
+MeshStatistics::clear()
+{
+	nbNodes_ = 0;
+	nbCellsPerType_.clear();
+	for(int d=0; d<4; d++) {
+		nbCells_[d] = 0;
+		groups_[d].clear();
+		connectivityHash_[d] = 0;
+		idsHash_[d] = 0;
+		chunkChecksums_[d].clear();
+	}
+	chunkSize_ = 0;
+	for(int i=0; i<3; i++) {
+		min_[i] =  std::numeric_limits<double>::max();
+		max_[i] = -std::numeric_limits<double>::max();
+	}
+	coordsHash_ = 0;
+	storedChecksum_ = 0;
+	isStored_ = false;
+}
+/*----------------------------------------------------------------------------*/
+void
+MeshStatistics::addNodes(Lima::id_type ANb, const double* AX, const double* AY,
+		const double* AZ, const Lima::id_type* AIDs)
+{
+	uint64_t h = coordsHash_;
+	uint64_t hIDs = idsHash_[0];
+	for(Lima::id_type i=0; i<ANb; i++) {
+		if(AX[i] < min_[0]) min_[0] = AX[i];
+		if(AX[i] > max_[0]) max_[0] = AX[i];
+		if(AY[i] < min_[1]) min_[1] = AY[i];
+		if(AY[i] > max_[1]) max_[1] = AY[i];
+		if(AZ[i] < min_[2]) min_[2] = AZ[i];
+		if(AZ[i] > max_[2]) max_[2] = AZ[i];
+		h = MeshHash::combine(h,coordBits(AX[i]));
+		h = MeshHash::combine(h,coordBits(AY[i]));
+		h = MeshHash::combine(h,coordBits(AZ[i]));
+		hIDs = MeshHash::combine(hIDs,AIDs[i]);
+	}
+	coordsHash_ = h;
+	idsHash_[0] = hIDs;
+	nbNodes_ += ANb;
+
+	if(chunkSize_ > 0) {
+		chunkChecksums_[0].push_back(hashNodeChunk(ANb,AX,AY,AZ,AIDs));
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+MeshStatistics::addCells(int ADim, Lima::id_type ANb, const Lima::id_type* ANodes,
+		Lima::id_type ANbNodes, const Lima::id_type* AIDs)
+{
+	uint64_t h = connectivityHash_[ADim];
+	for(Lima::id_type i=0; i<ANbNodes; i++) {
+		h = MeshHash::combine(h,ANodes[i]);
+	}
+	connectivityHash_[ADim] = h;
+
+	uint64_t hIDs = idsHash_[ADim];
+	for(Lima::id_type i=0; i<ANb; i++) {
+		hIDs = MeshHash::combine(hIDs,AIDs[i]);
+	}
+	idsHash_[ADim] = hIDs;
+	nbCells_[ADim] += ANb;
+
+	if(chunkSize_ > 0) {
+		chunkChecksums_[ADim].push_back(hashCellChunk(ANb,ANodes,ANbNodes,AIDs));
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+MeshStatistics::setChunkChecksums(Lima::id_type AChunkSize)
+{
+	chunkSize_ = AChunkSize;
+	for(int d=0; d<4; d++) {
+		chunkChecksums_[d].clear();
+	}
+}
+/*----------------------------------------------------------------------------*/
+uint64_t
+MeshStatistics::hashNodeChunk(std::size_t ANb, const double* AX, const double* AY,
+		const double* AZ, const Lima::id_type* AIDs)
+{
+	uint64_t h = ANb;
+	for(std::size_t i=0; i<ANb; i++) {
+		h = MeshHash::combine(h,AIDs[i]);
+		h = MeshHash::combine(h,coordBits(AX[i]));
+		h = MeshHash::combine(h,coordBits(AY[i]));
+		h = MeshHash::combine(h,coordBits(AZ[i]));
+	}
+	return h;
+}
+/*----------------------------------------------------------------------------*/
+uint64_t
+MeshStatistics::hashCellChunk(std::size_t ANb, const Lima::id_type* ANodes,
+		std::size_t ANbNodes, const Lima::id_type* AIDs)
+{
+	uint64_t h = MeshHash::combine(ANb,ANbNodes);
+	for(std::size_t i=0; i<ANbNodes; i++) {
+		h = MeshHash::combine(h,ANodes[i]);
+	}
+	for(std::size_t i=0; i<ANb; i++) {
+		h = MeshHash::combine(h,AIDs[i]);
+	}
+	return h;
+}
+/*----------------------------------------------------------------------------*/
+void
+MeshStatistics::addGroup(int ADim, const std::string& AName, std::size_t ASize)
+{
+	groups_[ADim].push_back(std::make_pair(AName,ASize));
+}
+/*----------------------------------------------------------------------------*/
+std::size_t
+MeshStatistics::getNbCells(gmds::ECellType AType) const
+{
+	std::map<gmds::ECellType,std::size_t>::const_iterator it = nbCellsPerType_.find(AType);
+	return it == nbCellsPerType_.end()?0:it->second;
+}
+/*----------------------------------------------------------------------------*/
+uint64_t
+MeshStatistics::getChecksum() const
+{
+	if(isStored_) {
+		return storedChecksum_;
+	}
+	uint64_t h = MeshHash::combine(nbNodes_,coordsHash_);
+	for(int d=0; d<4; d++) {
+		h = MeshHash::combine(h,nbCells_[d]);
+		h = MeshHash::combine(h,connectivityHash_[d]);
+		h = MeshHash::combine(h,idsHash_[d]);
+	}
+	return h;
+}
+/*----------------------------------------------------------------------------*/
+std::string
+MeshStatistics::getTypeName(gmds::ECellType AType)
+{
+	for(int i=0; i<nbKnownTypes; i++) {
+		if(knownTypes[i] == AType) {
+			return knownTypeNames[i];
+		}
+	}
+	return "type"+toString(static_cast<int>(AType));
+}
+/*----------------------------------------------------------------------------*/
+void
+MeshStatistics::toMeta(LimaMetaFile& AMeta) const
+{
+	for(int d=0; d<4; d++) {
+		AMeta.set(std::string("stats.")+dimNames[d],
+				toString(d==0?nbNodes_:nbCells_[d]));
+	}
+	if(nbNodes_ > 0) {
+		AMeta.set("stats.bbox",toString(min_[0])+" "+toString(min_[1])+" "+toString(min_[2])+" "
+				+toString(max_[0])+" "+toString(max_[1])+" "+toString(max_[2]));
+	}
+	for(std::map<gmds::ECellType,std::size_t>::const_iterator it = nbCellsPerType_.begin();
+		it != nbCellsPerType_.end(); ++it) {
+		AMeta.set("stats.type."+getTypeName(it->first),toString(it->second));
+	}
+	for(int d=0; d<4; d++) {
+		for(std::size_t i=0; i<groups_[d].size(); i++) {
+			AMeta.set("stats.group."+toString(d)+"."+toString(i),
+					toString(groups_[d][i].second)+" "+groups_[d][i].first);
+		}
+	}
+	AMeta.set("stats.checksum",MeshHash::toString(getChecksum()));
+
+	if(chunkSize_ > 0) {
+		AMeta.set("verify.chunk",toString(chunkSize_));
+		for(int d=0; d<4; d++) {
+			std::string checksums;
+			for(std::size_t i=0; i<chunkChecksums_[d].size(); i++) {
+				if(i > 0) {
+					checksums += ' ';
+				}
+				checksums += MeshHash::toString(chunkChecksums_[d][i]);
+			}
+			AMeta.set(std::string("verify.")+dimNames[d],checksums);
+		}
+	}
+}
+/*----------------------------------------------------------------------------*/
+bool
+MeshStatistics::fromMeta(const LimaMetaFile& AMeta)
+{
+	clear();
+	if(!AMeta.has("stats.checksum")) {
+		return false;
+	}
+
+	for(int d=0; d<4; d++) {
+		std::istringstream s(AMeta.get(std::string("stats.")+dimNames[d]));
+		s>>(d==0?nbNodes_:nbCells_[d]);
+	}
+	if(AMeta.has("stats.bbox")) {
+		std::istringstream s(AMeta.get("stats.bbox"));
+		s>>min_[0]>>min_[1]>>min_[2]>>max_[0]>>max_[1]>>max_[2];
+	}
+
+	const std::map<std::string,std::string>& entries = AMeta.getEntries();
+	for(std::map<std::string,std::string>::const_iterator it = entries.begin();
+		it != entries.end(); ++it) {
+		const std::string& key = it->first;
+		if(key.compare(0,11,"stats.type.") == 0) {
+			const std::string name = key.substr(11);
+			gmds::ECellType type = GMDS_NODE;
+			bool found = false;
+			for(int i=0; i<nbKnownTypes && !found; i++) {
+				if(name == knownTypeNames[i]) {
+					type = knownTypes[i];
+					found = true;
+				}
+			}
+			if(!found && name.compare(0,4,"type") == 0) {
+				type = static_cast<gmds::ECellType>(std::atoi(name.c_str()+4));
+				found = true;
+			}
+			if(found) {
+				std::istringstream s(it->second);
+				s>>nbCellsPerType_[type];
+			}
+		}
+		else if(key.compare(0,12,"stats.group.") == 0) {
+			std::istringstream s(key.substr(12));
+			int dim;
+			char dot;
+			std::size_t index;
+			if(!(s>>dim>>dot>>index) || dim<0 || dim>3) {
+				continue;
+			}
+			std::istringstream v(it->second);
+			std::size_t size = 0;
+			v>>size;
+			std::string name;
+			v.get();
+			std::getline(v,name);
+			if(groups_[dim].size() <= index) {
+				groups_[dim].resize(index+1);
+			}
+			groups_[dim][index] = std::make_pair(name,size);
+		}
+	}
+
+	if(AMeta.has("verify.chunk")) {
+		std::istringstream s(AMeta.get("verify.chunk"));
+		s>>chunkSize_;
+		for(int d=0; d<4; d++) {
+			std::istringstream c(AMeta.get(std::string("verify.")+dimNames[d]));
+			std::string checksum;
+			while(c>>checksum) {
+				chunkChecksums_[d].push_back(MeshHash::fromString(checksum));
+			}
+		}
+	}
+
+	storedChecksum_ = MeshHash::fromString(AMeta.get("stats.checksum"));
+	isStored_ = true;
+	return true;
+}
+/*----------------------------------------------------------------------------*/
+bool
+MeshStatistics::probe(const std::string& AFileName, MeshStatistics& AStats)
+{
+	LimaMetaFile meta;
+	if(!meta.read(AFileName)) {
+		AStats.clear();
+		return false;
+	}
+	return AStats.fromMeta(meta);
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,144 @@
+/*----------------------------------------------------------------------------*/
+/** \file    SpaceFillingCurve.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/SpaceFillingCurve.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <limits>
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+// Interleave the NB_BITS lowest bits of the three coordinates, the bit of
+// AX being the most significant one at each level.
+uint64_t
+interleave(uint32_t AX, uint32_t AY, uint32_t AZ)
+{
+	uint64_t key = 0;
+	for(int bit=SpaceFillingCurve::NB_BITS-1; bit>=0; bit--) {
+		key = (key<<1) | ((AX>>bit)&1);
+		key = (key<<1) | ((AY>>bit)&1);
+		key = (key<<1) | ((AZ>>bit)&1);
+	}
+	return key;
+}
+/*----------------------------------------------------------------------------*/
+// Key comparison used to sort indices
+struct KeyLess {
+	KeyLess(const std::vector<uint64_t>& AKeys):keys_(AKeys){}
+	bool operator()(std::size_t AI, std::size_t AJ) const {
+		return keys_[AI]<keys_[AJ];
+	}
+	const std::vector<uint64_t>& keys_;
+};
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+SpaceFillingCurve::SpaceFillingCurve(ERenumbering AType)
+:type_(AType)
+{
+	for(int i=0; i<3; i++) {
+		min_[i] =  std::numeric_limits<double>::max();
+		max_[i] = -std::numeric_limits<double>::max();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void
+SpaceFillingCurve::addToBoundingBox(double AX, double AY, double AZ)
+{
+	const double p[3] = {AX, AY, AZ};
+	for(int i=0; i<3; i++) {
+		min_[i] = std::min(min_[i],p[i]);
+		max_[i] = std::max(max_[i],p[i]);
+	}
+}
+/*----------------------------------------------------------------------------*/
+uint64_t
+SpaceFillingCurve::key(double AX, double AY, double AZ) const
+{
+	const double p[3] = {AX, AY, AZ};
+	const uint32_t gridMax = (1u<<NB_BITS)-1;
+
+	uint32_t q[3];
+	for(int i=0; i<3; i++) {
+		const double extent = max_[i]-min_[i];
+		if(extent <= 0.) {
+			q[i] = 0;
+			continue;
+		}
+		double t = (p[i]-min_[i])/extent;
+		t = std::max(0., std::min(1., t));
+		q[i] = static_cast<uint32_t>(t*gridMax);
+	}
+
+	if(type_ == GMDSCEA_RENUMBER_HILBERT) {
+		return hilbertKey(q[0],q[1],q[2]);
+	}
+	return mortonKey(q[0],q[1],q[2]);
+}
+/*----------------------------------------------------------------------------*/
+void
+SpaceFillingCurve::sort(const std::vector<uint64_t>& AKeys,
+						std::vector<std::size_t>& AOrder)
+{
+	AOrder.resize(AKeys.size());
+	for(std::size_t i=0; i<AKeys.size(); i++) {
+		AOrder[i] = i;
+	}
+	// stable so that equal keys keep the original order
+	std::stable_sort(AOrder.begin(), AOrder.end(), KeyLess(AKeys));
+}
+/*----------------------------------------------------------------------------*/
+uint64_t
+SpaceFillingCurve::mortonKey(uint32_t AX, uint32_t AY, uint32_t AZ)
+{
+	return interleave(AX,AY,AZ);
+}
+/*----------------------------------------------------------------------------*/
+uint64_t
+SpaceFillingCurve::hilbertKey(uint32_t AX, uint32_t AY, uint32_t AZ)
+{
+	// J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004.
+	// The coordinates are transformed in place into the "transposed" Hilbert
+	// index, which is then interleaved like a Morton key.
+	uint32_t x[3] = {AX, AY, AZ};
+	const uint32_t m = 1u<<(NB_BITS-1);
+
+	// inverse undo
+	for(uint32_t q=m; q>1; q>>=1) {
+		const uint32_t p = q-1;
+		for(int i=0; i<3; i++) {
+			if(x[i] & q) {
+				x[0] ^= p;
+			}
+			else {
+				const uint32_t t = (x[0]^x[i]) & p;
+				x[0] ^= t;
+				x[i] ^= t;
+			}
+		}
+	}
+
+	// Gray encode
+	for(int i=1; i<3; i++) {
+		x[i] ^= x[i-1];
+	}
+	uint32_t t = 0;
+	for(uint32_t q=m; q>1; q>>=1) {
+		if(x[2] & q) {
+			t ^= q-1;
+		}
+	}
+	for(int i=0; i<3; i++) {
+		x[i] ^= t;
+	}
+
+	return interleave(x[0],x[1],x[2]);
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
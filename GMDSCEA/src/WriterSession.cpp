@@ -0,0 +1,60 @@
+/*----------------------------------------------------------------------------*/
+/** \file    WriterSession.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "GMDSCEA/WriterSession.h"
+/*----------------------------------------------------------------------------*/
+namespace gmds{
+/*----------------------------------------------------------------------------*/
+WriterSession::WriterSession(gmds::IGMesh& AMesh, gmds::MeshModel AModel)
+:model_(AModel), writer_(AMesh), nbWrites_(0)
+{
+
+}
+/*----------------------------------------------------------------------------*/
+WriterSession::~WriterSession()
+{
+
+}
+/*----------------------------------------------------------------------------*/
+void
+WriterSession::setOptions(const WriterOptions& AOptions)
+{
+	writer_.setOptions(AOptions);
+}
+/*----------------------------------------------------------------------------*/
+void
+WriterSession::setLengthUnit(double AUnit)
+{
+	writer_.setLengthUnit(AUnit);
+}
+/*----------------------------------------------------------------------------*/
+void
+WriterSession::write(const std::string& AFileName)
+{
+	writer_.write(AFileName,model_);
+	nbWrites_++;
+}
+/*----------------------------------------------------------------------------*/
+int
+WriterSession::getNbWrites() const
+{
+	return nbWrites_;
+}
+/*----------------------------------------------------------------------------*/
+const MeshStatistics&
+WriterSession::getStatistics() const
+{
+	return writer_.getStatistics();
+}
+/*----------------------------------------------------------------------------*/
+void
+WriterSession::release()
+{
+	writer_.releaseBuffers();
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace gmds
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,65 @@
+/*----------------------------------------------------------------------------*/
+#include <cstdlib>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+/*----------------------------------------------------------------------------*/
+#include <GMDSCEA/ConnectivityCodec.h>
+/*----------------------------------------------------------------------------*/
+using namespace gmds;
+/*----------------------------------------------------------------------------*/
+class ConnectivityCodecTest: public ::testing::Test {
+
+  protected:
+	ConnectivityCodecTest(){;}
+    virtual ~ConnectivityCodecTest(){;}
+};
+/*----------------------------------------------------------------------------*/
+TEST_F(ConnectivityCodecTest,zigzag) {
+	EXPECT_EQ(0,ConnectivityCodec::zigzag(0));
+	EXPECT_EQ(1,ConnectivityCodec::zigzag(-1));
+	EXPECT_EQ(2,ConnectivityCodec::zigzag(1));
+	for(int64_t v=-1000; v<1000; v++) {
+		EXPECT_EQ(v,ConnectivityCodec::unzigzag(ConnectivityCodec::zigzag(v)));
+	}
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(ConnectivityCodecTest,roundTrip) {
+	// ids of a structured hexahedral mesh with some large jumps
+	std::vector<uint64_t> ids;
+	for(uint64_t i=0; i<1000; i++) {
+		ids.push_back(i);
+		ids.push_back(i+1);
+		ids.push_back(i+11);
+		ids.push_back(i+10);
+	}
+	ids.push_back(static_cast<uint64_t>(1)<<40);
+	ids.push_back(0);
+
+	std::vector<uint8_t> buffer;
+	ConnectivityCodec::encode(&ids[0],ids.size(),buffer);
+	EXPECT_LT(buffer.size(),ids.size()+16);
+
+	std::vector<uint64_t> decoded(ids.size());
+	EXPECT_EQ(buffer.size(),ConnectivityCodec::decode(&buffer[0],buffer.size(),
+			decoded.size(),&decoded[0]));
+	EXPECT_EQ(ids,decoded);
+
+	EXPECT_THROW(ConnectivityCodec::decode(&buffer[0],buffer.size()-1,
+			decoded.size(),&decoded[0]),GMDSException);
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(ConnectivityCodecTest,cells) {
+	std::size_t offsets[] = {0,3,7,10};
+	std::size_t nodes[] = {0,1,2, 1,2,4,3, 5,6,7};
+
+	std::vector<uint8_t> buffer;
+	ConnectivityCodec::encodeCells(offsets,nodes,1,2,buffer);
+
+	std::size_t decoded[7];
+	ConnectivityCodec::decode(&buffer[0],buffer.size(),7,decoded);
+	for(int i=0; i<7; i++) {
+		EXPECT_EQ(nodes[3+i],decoded[i]);
+	}
+}
+/*----------------------------------------------------------------------------*/
@@ -1,13 +1,31 @@
 /*----------------------------------------------------------------------------*/
+#include<cmath>
+#include<limits>
 #include<string>
 /*----------------------------------------------------------------------------*/
+#include <glob.h>
+/*----------------------------------------------------------------------------*/
 #include <gtest/gtest.h>
 #include <Lima/malipp.h>
 /*----------------------------------------------------------------------------*/
 #include <GMDS/IG/IG.h>
+#include <GMDSCEA/LimaChunkReader.h>
+#include <GMDSCEA/LimaDiff.h>
+#include <GMDSCEA/LimaFlatReader.h>
 #include <GMDSCEA/LimaReader.h>
+#include <GMDSCEA/LimaStager.h>
+#include <GMDSCEA/LimaTranscoder.h>
+#include <GMDSCEA/LimaVerifier.h>
+#include <GMDSCEA/LimaViewWriter.h>
+#include <GMDSCEA/IGMeshView.h>
+#include <GMDSCEA/SoAMeshView.h>
 #include <GMDSCEA/LimaWriter.h>
 #include <GMDSCEA/LimaWriterAPI.h>
+#include <GMDSCEA/GMDSCEAWriter.h>
+#include <GMDSCEA/LimaMetaFile.h>
+#include <GMDSCEA/MeshHash.h>
+#include <GMDSCEA/MeshStatistics.h>
+#include <GMDSCEA/WriterSession.h>
 /*----------------------------------------------------------------------------*/
 using namespace gmds;
 /*----------------------------------------------------------------------------*/
@@ -92,3 +110,826 @@ TEST_F(LimaAPITest,write2) {
 	reader2.read("Data/chess.mli",R|F|N);
 }
 /*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,writeSingleCellType) {
+	MeshModel mod = DIM3|N|F|R|F2N|R2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(0,1,0);
+	Node n4 = mesh.newNode(0,0,1);
+	Node n5 = mesh.newNode(1,1,1);
+	mesh.newTet(n1,n2,n3,n4);
+	mesh.newTet(n2,n3,n4,n5);
+	mesh.newTriangle(n1,n2,n3);
+	mesh.newTriangle(n2,n3,n5);
+
+	gmds::IGMesh::volume& vol = mesh.newVolume("vol0");
+	vol.add(mesh.get<Region>(1));
+
+	gmds::LimaWriterAPI writer (mesh);
+	writer.write("Data/tets.mli2",mod);
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader(mesh2);
+	reader.read("Data/tets.mli2",R|F|N);
+
+	EXPECT_EQ(mesh.getNbNodes(),mesh2.getNbNodes());
+	EXPECT_EQ(mesh.getNbFaces(),mesh2.getNbFaces());
+	EXPECT_EQ(mesh.getNbRegions(),mesh2.getNbRegions());
+	EXPECT_EQ(1,mesh2.getVolume(0).size());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,readPolygons) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+
+	// a pentagon and a heptagon sharing an edge
+	std::vector<Node> nodes;
+	nodes.push_back(mesh.newNode(0,0,0));
+	nodes.push_back(mesh.newNode(1,0,0));
+	nodes.push_back(mesh.newNode(2,1,0));
+	nodes.push_back(mesh.newNode(1,2,0));
+	nodes.push_back(mesh.newNode(0,1,0));
+	mesh.newPolygon(nodes);
+
+	std::vector<Node> nodes2;
+	nodes2.push_back(nodes[1]);
+	nodes2.push_back(mesh.newNode(2,-1,0));
+	nodes2.push_back(mesh.newNode(3,-1,0));
+	nodes2.push_back(mesh.newNode(4,0,0));
+	nodes2.push_back(mesh.newNode(4,1,0));
+	nodes2.push_back(mesh.newNode(3,2,0));
+	nodes2.push_back(nodes[2]);
+	mesh.newPolygon(nodes2);
+
+	gmds::IGMesh::surface& surf = mesh.newSurface("surf0");
+	surf.add(mesh.get<Face>(1));
+
+	gmds::LimaWriterAPI writer (mesh);
+	writer.write("Data/polygons.mli2",mod);
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader(mesh2);
+	reader.read("Data/polygons.mli2",F|N);
+
+	EXPECT_EQ(2,mesh2.getNbFaces());
+	EXPECT_EQ(1,mesh2.getNbSurfaces());
+	EXPECT_EQ(7,mesh2.getSurface(0).cells()[0].getNbNodes());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,writeRenumbered) {
+	MeshModel mod = DIM3|N|R|R2N;
+	IGMesh mesh(mod);
+
+	LimaReader<IGMesh> reader(mesh);
+	reader.read("Data/bar.mli",R|N);
+
+	gmds::LimaWriterAPI writer (mesh);
+	writer.setRenumbering(GMDSCEA_RENUMBER_HILBERT);
+	writer.write("Data/bar_hilbert.mli2",mod);
+	EXPECT_EQ(mesh.getMaxLocalID(0)+1,writer.getLimaIDs(0).size());
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader2(mesh2);
+	reader2.setRenumbering(GMDSCEA_RENUMBER_MORTON);
+	reader2.read("Data/bar_hilbert.mli2",R|N);
+
+	EXPECT_EQ(mesh.getNbNodes(),mesh2.getNbNodes());
+	EXPECT_EQ(mesh.getNbRegions(),mesh2.getNbRegions());
+
+	// a second read reuses the lima_id variables
+	EXPECT_NO_THROW(reader2.read("Data/bar_hilbert.mli2",R|N));
+	EXPECT_EQ(2*mesh.getNbRegions(),mesh2.getNbRegions());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,writeCompact) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(1,1,0);
+	Node n4 = mesh.newNode(0,1,0);
+	Node n5 = mesh.newNode(2,2,0);
+	Face f1 = mesh.newTriangle(n1,n2,n3);
+	mesh.newTriangle(n1,n3,n4);
+
+	// holes in the node and face containers
+	mesh.deleteNode(n5);
+	mesh.deleteFace(f1);
+
+	gmds::IGMesh::cloud& cl = mesh.newCloud("cloud0");
+	cl.add(n4);
+
+	gmds::LimaWriterAPI writer (mesh);
+	writer.write("Data/compact.mli2",mod,true);
+	EXPECT_TRUE(writer.getLimaIDs(0).empty());
+	EXPECT_EQ(1,writer.getLimaIDs(2)[1]);
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader(mesh2);
+	reader.read("Data/compact.mli2",F|N);
+
+	EXPECT_EQ(4,mesh2.getNbNodes());
+	EXPECT_EQ(1,mesh2.getNbFaces());
+	EXPECT_EQ(1,mesh2.getCloud(0).size());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,restartPreservesIDs) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(1,1,0);
+	Node n4 = mesh.newNode(0,1,0);
+	Node n5 = mesh.newNode(2,2,0);
+	Face f1 = mesh.newTriangle(n1,n2,n3);
+	Face f2 = mesh.newTriangle(n1,n3,n5);
+	Face f3 = mesh.newTriangle(n1,n3,n4);
+	Face f4 = mesh.newTriangle(n1,n3,n5);
+	Node n6 = mesh.newNode(3,3,0);
+	mesh.deleteFace(f2);
+	mesh.deleteNode(n2);
+	mesh.deleteFace(f1);
+	// holes after the last id, recorded in the metadata file
+	mesh.deleteNode(n6);
+	mesh.deleteFace(f4);
+
+	gmds::LimaWriterAPI writer (mesh);
+	writer.write("Data/restart.mli2",mod);
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader(mesh2);
+	reader.setPreserveIDs(true);
+	reader.read("Data/restart.mli2",F|N);
+
+	EXPECT_EQ(mesh.getNbNodes(),mesh2.getNbNodes());
+	EXPECT_EQ(1,mesh2.getNbFaces());
+
+	Face f = mesh2.get<Face>(f3.getID());
+	std::vector<TCellID> ids = f.getIDs<Node>();
+	EXPECT_EQ(n1.getID(),ids[0]);
+	EXPECT_EQ(n3.getID(),ids[1]);
+	EXPECT_EQ(n4.getID(),ids[2]);
+	EXPECT_DOUBLE_EQ(1.,mesh2.get<Node>(n4.getID()).Y());
+
+	// the id range is the same, new cells get the same ids
+	EXPECT_EQ(mesh.getMaxLocalID(0),mesh2.getMaxLocalID(0));
+	EXPECT_EQ(mesh.getMaxLocalID(2),mesh2.getMaxLocalID(2));
+	EXPECT_EQ(mesh.newNode(4,4,0).getID(),mesh2.newNode(4,4,0).getID());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,transcode) {
+	LimaTranscoder transcoder;
+	transcoder.setChunkSize(100);
+	transcoder.transcode("Data/bar.mli","Data/bar_transcoded.mli2");
+
+	MeshModel mod = DIM3|N|R|R2N;
+	IGMesh mesh(mod);
+	LimaReader<IGMesh> reader(mesh);
+	reader.read("Data/bar.mli",R|N);
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader2(mesh2);
+	reader2.read("Data/bar_transcoded.mli2",R|N);
+
+	EXPECT_EQ(mesh.getNbNodes(),transcoder.getNbCells(0));
+	EXPECT_EQ(mesh.getNbNodes(),mesh2.getNbNodes());
+	EXPECT_EQ(mesh.getNbRegions(),mesh2.getNbRegions());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,writeReadBuffer) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(1,1,0);
+	mesh.newTriangle(n1,n2,n3);
+
+	std::vector<char> buffer;
+	gmds::LimaWriterAPI writer (mesh);
+	writer.writeToBuffer(buffer,mod);
+	EXPECT_FALSE(buffer.empty());
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader(mesh2);
+	reader.readFromBuffer(&buffer[0],buffer.size(),F|N);
+
+	EXPECT_EQ(3,mesh2.getNbNodes());
+	EXPECT_EQ(1,mesh2.getNbFaces());
+
+	// a mesh with id holes leaves no metadata file behind
+	mesh.deleteNode(mesh.newNode(2,2,0));
+	writer.writeToBuffer(buffer,mod);
+	glob_t meta;
+	EXPECT_NE(0,glob((LimaMemoryFile::getDirectory()+"/gmdscea_*.meta").c_str(),0,0,&meta));
+	globfree(&meta);
+}
+/*----------------------------------------------------------------------------*/
+class CountingVisitor: public LimaChunkVisitor {
+public:
+	CountingVisitor():nbNodes(0),nbRegions(0),nbChunks(0){}
+
+	virtual void visitNodes(const LimaNodeChunk& AChunk) {
+		nbNodes += AChunk.size;
+	}
+	virtual void visitRegions(const LimaCellChunk& AChunk) {
+		nbRegions += AChunk.size;
+		nbChunks++;
+		EXPECT_TRUE(AChunk.x != 0);
+	}
+
+	std::size_t nbNodes, nbRegions, nbChunks;
+};
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,visitChunks) {
+	MeshModel mod = DIM3|N|R|R2N;
+	IGMesh mesh(mod);
+	LimaReader<IGMesh> reader(mesh);
+	reader.read("Data/bar.mli",R|N);
+
+	LimaChunkReader chunkReader("Data/bar.mli");
+	chunkReader.setMemoryBudget(1);
+	chunkReader.setResolveCoordinates(true);
+	EXPECT_EQ(1,chunkReader.getChunkSize());
+
+	CountingVisitor visitor;
+	chunkReader.visit(visitor,N|R);
+
+	EXPECT_EQ(mesh.getNbNodes(),visitor.nbNodes);
+	EXPECT_EQ(mesh.getNbRegions(),visitor.nbRegions);
+	EXPECT_EQ(visitor.nbRegions,visitor.nbChunks);
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,writeSoAView) {
+	// two triangles sharing an edge, and a face group with the second one
+	const double x[4] = {0.,1.,1.,0.};
+	const double y[4] = {0.,0.,1.,1.};
+	const std::size_t offsets[3] = {0,3,6};
+	const std::size_t nodes[6] = {0,1,2, 0,2,3};
+	const ECellType types[2] = {GMDS_TRIANGLE,GMDS_TRIANGLE};
+	const std::size_t group[1] = {1};
+
+	SoAMeshView view;
+	view.dim = 2;
+	view.nbNodes = 4;
+	view.x = x;
+	view.y = y;
+	SoAMeshView::Cells faces = {2, offsets, nodes, types};
+	view.cells[2] = faces;
+	SoAMeshView::Group surf = {"surf", 1, group};
+	view.groups[2].push_back(surf);
+
+	LimaViewWriter<SoAMeshView> writer(view);
+	writer.write("Data/soa.mli2",N|F);
+
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+	LimaReader<IGMesh> reader(mesh);
+	reader.read("Data/soa.mli2",F|N);
+
+	EXPECT_EQ(4,mesh.getNbNodes());
+	EXPECT_EQ(2,mesh.getNbFaces());
+	EXPECT_EQ(1,mesh.getNbSurfaces());
+	EXPECT_EQ(1,mesh.getSurface(0).size());
+
+	// the same mesh through the IGMesh adapter
+	IGMeshView meshView(mesh);
+	LimaViewWriter<IGMeshView> writer2(meshView);
+	writer2.write("Data/soa2.mli2",N|F);
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader2(mesh2);
+	reader2.read("Data/soa2.mli2",F|N);
+	EXPECT_EQ(4,mesh2.getNbNodes());
+	EXPECT_EQ(2,mesh2.getNbFaces());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,writeViewOptions) {
+	const double x[4] = {0.,1.,1.,0.};
+	const double y[4] = {0.,0.,1.,1.123456789};
+	const std::size_t offsets[3] = {0,3,6};
+	const std::size_t nodes[6] = {0,1,2, 0,2,3};
+	const ECellType types[2] = {GMDS_TRIANGLE,GMDS_TRIANGLE};
+
+	SoAMeshView view;
+	view.dim = 2;
+	view.nbNodes = 4;
+	view.x = x;
+	view.y = y;
+	SoAMeshView::Cells faces = {2, offsets, nodes, types};
+	view.cells[2] = faces;
+
+	WriterOptions options = WriterOptions::preview(1e-3);
+	options.metadata = true;
+	LimaViewWriter<SoAMeshView> writer(view);
+	if(!LimaWriterAPI::hasCompression()) {
+		// the rounding would not shrink the file
+		EXPECT_THROW(writer.setOptions(options),GMDSException);
+		options = WriterOptions();
+		options.metadata = true;
+	}
+	writer.setOptions(options);
+	writer.write("Data/soa_options.mli2",N|F);
+
+	EXPECT_EQ(4,writer.getStatistics().getNbNodes());
+	EXPECT_EQ(2,writer.getStatistics().getNbCells(GMDS_TRIANGLE));
+	MeshStatistics probed;
+	ASSERT_TRUE(MeshStatistics::probe("Data/soa_options.mli2",probed));
+	EXPECT_EQ(writer.getStatistics().getChecksum(),probed.getChecksum());
+
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+	LimaReader<IGMesh> reader(mesh);
+	reader.read("Data/soa_options.mli2",F|N);
+	EXPECT_NEAR(1.123456789,mesh.get<Node>(3).Y(),0.5e-3);
+	if(LimaWriterAPI::hasCompression()) {
+		EXPECT_EQ(0.,std::fmod(mesh.get<Node>(3).Y()*1024.,1.));
+	}
+
+	// a failed write leaves the previous file, and the writer can be used
+	// again
+	const ECellType regionTypes[2] = {GMDS_POLYGON,GMDS_POLYGON};
+	SoAMeshView::Cells regions = {2, offsets, nodes, regionTypes};
+	view.cells[3] = regions;
+	EXPECT_THROW(writer.write("Data/soa_options.mli2",N|F|R),GMDSException);
+	writer.write("Data/soa_options.mli2",N|F);
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader2(mesh2);
+	reader2.read("Data/soa_options.mli2",F|N);
+	EXPECT_EQ(2,mesh2.getNbFaces());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,readFlat) {
+	MeshModel mod = DIM3|N|R|R2N;
+	IGMesh mesh(mod);
+	LimaReader<IGMesh> reader(mesh);
+	reader.read("Data/bar.mli",R|N);
+
+	FlatMesh flat;
+	LimaFlatReader flatReader(flat);
+	flatReader.read("Data/bar.mli",R|N);
+
+	EXPECT_EQ(mesh.getNbNodes(),flat.x.size());
+	EXPECT_EQ(mesh.getNbRegions(),flat.getNbCells(3));
+	EXPECT_EQ(flat.getNbCells(3)+1,flat.cells[3].offsets.size());
+	EXPECT_EQ(flat.cells[3].offsets.back(),flat.cells[3].nodes.size());
+
+	// the flat mesh can be written back through its view
+	SoAMeshView view = flat.view();
+	LimaViewWriter<SoAMeshView> writer(view);
+	writer.write("Data/bar_flat.mli2",N|R);
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader2(mesh2);
+	reader2.read("Data/bar_flat.mli2",R|N);
+	EXPECT_EQ(mesh.getNbRegions(),mesh2.getNbRegions());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,ids64) {
+	const TCellID maxID = std::numeric_limits<TCellID>::max();
+	EXPECT_EQ(static_cast<Lima::id_type>(maxID)+1,toLimaID(maxID));
+	EXPECT_EQ(maxID,toCellID(toLimaID(maxID)));
+	EXPECT_THROW(toCellID(0),GMDSException);
+	if(sizeof(Lima::id_type) > sizeof(TCellID)) {
+		EXPECT_THROW(toCellID(toLimaID(maxID)+1),GMDSException);
+	}
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,writeIDsBeyond32Bits) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(1,1,0);
+	mesh.newTriangle(n1,n2,n3);
+	mesh.newCloud("cloud").add(n3);
+
+	// file ids of a mesh with more than 2^32 nodes
+	const Lima::id_type big = (static_cast<Lima::id_type>(1)<<32)+5;
+	std::vector<Lima::id_type> ids(3);
+	ids[n1.getID()] = big;
+	ids[n2.getID()] = big+1;
+	ids[n3.getID()] = big+7;
+
+	gmds::LimaWriterAPI writer (mesh);
+	writer.setNodesLimaIDs(ids);
+	writer.write("Data/ids64.mli2",mod);
+
+	FlatMesh flat;
+	LimaFlatReader reader(flat);
+	reader.read("Data/ids64.mli2",F|N);
+
+	ASSERT_EQ(3,flat.nodeIDs.size());
+	EXPECT_EQ(big,flat.nodeIDs[0]);
+	EXPECT_EQ(big+7,flat.nodeIDs[2]);
+	EXPECT_EQ(2,flat.cells[2].nodes[2]);
+	EXPECT_EQ(2,flat.groups[0].cells[0]);
+
+	// the ids are looked up, no table of 2^32 nodes is built
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader2(mesh2);
+	reader2.read("Data/ids64.mli2",F|N);
+	EXPECT_EQ(3,mesh2.getNbNodes());
+	EXPECT_EQ(1,mesh2.getNbFaces());
+	ASSERT_EQ(1,mesh2.getNbClouds());
+	ASSERT_EQ(1,mesh2.getCloud(0).size());
+	EXPECT_DOUBLE_EQ(1.,mesh2.getCloud(0).cells()[0].Y());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,writerOptions) {
+	WriterOptions options = WriterOptions::stripedFileSystem(4096);
+	EXPECT_EQ(2048,options.getChunkSize());
+	options.chunkSize = 1000;
+	EXPECT_EQ(512,options.getChunkSize());
+	options.chunkSize = 10;
+	EXPECT_EQ(512,options.getChunkSize());
+
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(1,1,0);
+	Node n4 = mesh.newNode(0,1,0);
+	mesh.newTriangle(n1,n2,n3);
+	mesh.newTriangle(n1,n3,n4);
+
+	// one entity per call to Lima
+	WriterOptions small;
+	small.chunkSize = 1;
+	GMDSCEAWriter writer(mesh);
+	writer.setOptions(small);
+	writer.write("Data/options.mli2",mod);
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader(mesh2);
+	reader.read("Data/options.mli2",F|N);
+
+	EXPECT_EQ(4,mesh2.getNbNodes());
+	EXPECT_EQ(2,mesh2.getNbFaces());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,writeQuantized) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0.1,0,0);
+	Node n2 = mesh.newNode(1.123456789,0,0);
+	Node n3 = mesh.newNode(1,1.987654321,0.3);
+	mesh.newTriangle(n1,n2,n3);
+
+	// the step is 2^-10, the largest power of two <= 1e-3
+	const double step = LimaWriterAPI::getQuantizationStep(1e-3);
+	EXPECT_EQ(1./1024.,step);
+	EXPECT_EQ(0.,std::fmod(LimaWriterAPI::roundCoordinate(1.123456789,GMDSCEA_COORD_QUANTIZED,step)*1024.,1.));
+
+	WriterOptions options = WriterOptions::preview(1e-3);
+	options.compression = false;
+	gmds::LimaWriterAPI writer (mesh);
+	if(LimaWriterAPI::hasCompression()) {
+		writer.setOptions(options);
+		writer.write("Data/quantized.mli2",mod);
+
+		IGMesh mesh2(mod);
+		LimaReader<IGMesh> reader(mesh2);
+		reader.read("Data/quantized.mli2",F|N);
+
+		ASSERT_EQ(3,mesh2.getNbNodes());
+		EXPECT_NEAR(0.1,mesh2.get<Node>(0).X(),0.5e-3);
+		EXPECT_NEAR(1.123456789,mesh2.get<Node>(1).X(),0.5e-3);
+		EXPECT_NEAR(1.987654321,mesh2.get<Node>(2).Y(),0.5e-3);
+		EXPECT_EQ(0.,std::fmod(mesh2.get<Node>(1).X()*1024.,1.));
+		EXPECT_EQ(0.,std::fmod(mesh2.get<Node>(2).Y()*1024.,1.));
+	}
+	else {
+		// the rounding would not shrink the file
+		EXPECT_THROW(writer.setOptions(options),GMDSException);
+	}
+
+	// a rejected option set leaves the previous one
+	options.tolerance = 0.;
+	options.renumbering = GMDSCEA_RENUMBER_HILBERT;
+	EXPECT_THROW(writer.setOptions(options),GMDSException);
+	writer.write("Data/quantized.mli2",mod);
+	EXPECT_TRUE(writer.getLimaIDs(0).empty());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,meshHash) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(1,1,0);
+	mesh.newTriangle(n1,n2,n3);
+
+	MeshHash hash(mesh);
+	hash.setNbThreads(1);
+	const uint64_t h1 = hash.compute(mod);
+	hash.setNbThreads(4);
+	EXPECT_EQ(h1,hash.compute(mod));
+	EXPECT_EQ(h1,MeshHash::fromString(MeshHash::toString(h1)));
+
+	mesh.newCloud("cloud").add(n3);
+	const uint64_t h2 = hash.compute(mod);
+	EXPECT_NE(h1,h2);
+
+	mesh.newNode(0,0,1);
+	EXPECT_NE(h2,hash.compute(mod));
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,skipUnchanged) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(1,1,0);
+	mesh.newTriangle(n1,n2,n3);
+
+	GMDSCEAWriter writer(mesh);
+	writer.setSkipUnchanged(true);
+	writer.write("Data/step1.mli2",mod);
+	EXPECT_FALSE(writer.isLastWriteSkipped());
+
+	LimaMetaFile meta;
+	ASSERT_TRUE(meta.read("Data/step1.mli2"));
+	EXPECT_FALSE(meta.get("hash").empty());
+
+	// same content: the file is not rewritten
+	writer.write("Data/step1.mli2",mod);
+	EXPECT_TRUE(writer.isLastWriteSkipped());
+
+	// same content in another file: hard link
+	writer.write("Data/step2.mli2",mod);
+	EXPECT_TRUE(writer.isLastWriteSkipped());
+
+	// the chunk checksums are asked for: the file is rewritten with them
+	WriterOptions options;
+	options.verify = true;
+	writer.setOptions(options);
+	writer.write("Data/step1.mli2",mod);
+	EXPECT_FALSE(writer.isLastWriteSkipped());
+	LimaVerifier verifier;
+	EXPECT_TRUE(verifier.verify("Data/step1.mli2"));
+	writer.setOptions(WriterOptions());
+
+	// new content: the link is broken and step1 keeps its content
+	mesh.newNode(0,0,1);
+	writer.write("Data/step2.mli2",mod);
+	EXPECT_FALSE(writer.isLastWriteSkipped());
+
+	// same content in another format: written, not linked
+	writer.write("Data/step2.mli",mod);
+	EXPECT_FALSE(writer.isLastWriteSkipped());
+
+	IGMesh mesh1(mod);
+	LimaReader<IGMesh> reader1(mesh1);
+	reader1.read("Data/step1.mli2",F|N);
+	EXPECT_EQ(3,mesh1.getNbNodes());
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader2(mesh2);
+	reader2.read("Data/step2.mli2",F|N);
+	EXPECT_EQ(4,mesh2.getNbNodes());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,writeStatistics) {
+	MeshModel mod = DIM3|N|F|R|F2N|R2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(1,1,0);
+	Node n4 = mesh.newNode(0,1,2);
+	mesh.newTriangle(n1,n2,n3);
+	mesh.newQuad(n1,n2,n3,n4);
+	mesh.newTet(n1,n2,n3,n4);
+	mesh.newSurface("surf").add(mesh.get<Face>(0));
+
+	WriterOptions options;
+	options.metadata = true;
+	options.chunkSize = 1;
+	gmds::LimaWriterAPI writer (mesh);
+	writer.setOptions(options);
+	writer.write("Data/stats.mli2",mod);
+
+	const MeshStatistics& stats = writer.getStatistics();
+	EXPECT_EQ(4,stats.getNbNodes());
+	EXPECT_EQ(2,stats.getNbCells(2));
+	EXPECT_EQ(1,stats.getNbCells(GMDS_TRIANGLE));
+	EXPECT_EQ(1,stats.getNbCells(GMDS_QUAD));
+	EXPECT_EQ(1,stats.getNbCells(GMDS_TETRA));
+	EXPECT_DOUBLE_EQ(2.,stats.getMax()[2]);
+	ASSERT_EQ(1,stats.getGroups(2).size());
+	EXPECT_EQ(1,stats.getGroups(2)[0].second);
+
+	// the checksum does not depend on the chunk size
+	options.chunkSize = 1000;
+	gmds::LimaWriterAPI writer2 (mesh);
+	writer2.setOptions(options);
+	writer2.write("Data/stats2.mli2",mod);
+	EXPECT_EQ(stats.getChecksum(),writer2.getStatistics().getChecksum());
+
+	MeshStatistics probed;
+	ASSERT_TRUE(MeshStatistics::probe("Data/stats.mli2",probed));
+	EXPECT_EQ(stats.getChecksum(),probed.getChecksum());
+	EXPECT_EQ(1,probed.getNbCells(GMDS_QUAD));
+	EXPECT_DOUBLE_EQ(2.,probed.getMax()[2]);
+	ASSERT_EQ(1,probed.getGroups(2).size());
+	EXPECT_EQ("surf",probed.getGroups(2)[0].first);
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,verify) {
+	MeshModel mod = DIM3|N|F|R|F2N|R2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(1,1,0);
+	Node n4 = mesh.newNode(0,1,2);
+	Node n5 = mesh.newNode(1,1,2);
+	mesh.newTriangle(n1,n2,n3);
+	mesh.newQuad(n1,n2,n3,n4);
+	mesh.newTet(n1,n2,n3,n4);
+	mesh.newTet(n2,n3,n4,n5);
+
+	WriterOptions options;
+	options.verify = true;
+	options.chunkSize = 2;
+	gmds::LimaWriterAPI writer (mesh);
+	writer.setOptions(options);
+	writer.write("Data/verify.mli2",mod);
+	EXPECT_EQ(3,writer.getStatistics().getChunkChecksums(0).size());
+
+	LimaVerifier verifier;
+	verifier.setNbThreads(2);
+	EXPECT_TRUE(verifier.verify("Data/verify.mli2"));
+	EXPECT_TRUE(verifier.getErrors().empty());
+
+	// the file no longer matches its checksums
+	LimaMetaFile meta;
+	ASSERT_TRUE(meta.read("Data/verify.mli2"));
+	writer.setOptions(WriterOptions());
+	mesh.newNode(3,3,3);
+	writer.write("Data/verify.mli2",mod);
+	meta.write("Data/verify.mli2");
+	EXPECT_FALSE(verifier.verify("Data/verify.mli2"));
+	EXPECT_FALSE(verifier.getErrors().empty());
+
+	LimaMetaFile::remove("Data/verify.mli2");
+	EXPECT_THROW(verifier.verify("Data/verify.mli2"),GMDSException);
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,diff) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(1,1,0);
+	Node n4 = mesh.newNode(0,1,0);
+	mesh.newTriangle(n1,n2,n3);
+	mesh.newTriangle(n1,n3,n4);
+	mesh.newSurface("surf").add(mesh.get<Face>(0));
+
+	gmds::LimaWriterAPI writer (mesh);
+	writer.write("Data/diff1.mli2",mod);
+
+	LimaDiff diff;
+	EXPECT_TRUE(diff.compare("Data/diff1.mli2","Data/diff1.mli2"));
+	EXPECT_TRUE(diff.getDifferences().empty());
+
+	FlatMesh flat1;
+	LimaFlatReader reader(flat1);
+	reader.read("Data/diff1.mli2",F|N);
+
+	FlatMesh flat2 = flat1;
+	flat2.x[1] += 1e-9;
+	flat2.x[2] += 1.;
+	flat2.cells[2].nodes[4] = 3;
+	flat2.groups[2].names[0] = "other";
+
+	diff.setTolerance(1e-6);
+	EXPECT_FALSE(diff.compare(flat1,flat2));
+	EXPECT_EQ(1,diff.getNbDifferences(GMDSCEA_DIFF_COORDINATES));
+	EXPECT_EQ(1,diff.getNbDifferences(GMDSCEA_DIFF_CONNECTIVITY));
+	EXPECT_EQ(2,diff.getNbDifferences(GMDSCEA_DIFF_GROUP));
+	EXPECT_EQ(0,diff.getNbDifferences(GMDSCEA_DIFF_COUNT));
+
+	diff.setMaxDifferences(1);
+	EXPECT_FALSE(diff.compare(flat1,flat2));
+	EXPECT_EQ(3,diff.getDifferences().size());
+	EXPECT_EQ(2,diff.getNbDifferences(GMDSCEA_DIFF_GROUP));
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,writeAtomic) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(1,1,0);
+	mesh.newTriangle(n1,n2,n3);
+
+	gmds::LimaWriterAPI writer (mesh);
+	writer.write("Data/atomic.mli2",mod);
+
+	// a face with too many nodes for Lima makes the write fail
+	std::vector<Node> nodes;
+	for(int i=0; i<16; i++) {
+		nodes.push_back(mesh.newNode(i,2,0));
+	}
+	mesh.newPolygon(nodes);
+	EXPECT_THROW(writer.write("Data/atomic.mli2",mod),GMDSException);
+
+	// the previous file is still there and no temporary file is left
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader(mesh2);
+	reader.read("Data/atomic.mli2",F|N);
+	EXPECT_EQ(3,mesh2.getNbNodes());
+	EXPECT_EQ(1,mesh2.getNbFaces());
+
+	glob_t tmp;
+	EXPECT_NE(0,glob("Data/.atomic.mli2.*",0,0,&tmp));
+	globfree(&tmp);
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,writerSession) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(1,1,0);
+	Node n4 = mesh.newNode(0,1,0);
+	mesh.newTriangle(n1,n2,n3);
+	mesh.newQuad(n1,n2,n3,n4);
+
+	WriterOptions options;
+	options.chunkSize = 1;
+	WriterSession session(mesh,mod);
+	session.setOptions(options);
+
+	// the mesh grows between the steps, the buffers are reused
+	for(int step=0; step<3; step++) {
+		mesh.newNode(2,2,step);
+		session.write("Data/session"+std::to_string(step)+".mli2");
+		EXPECT_DOUBLE_EQ(step,session.getStatistics().getMax()[2]);
+	}
+	session.release();
+	session.write("Data/session3.mli2");
+	EXPECT_EQ(4,session.getNbWrites());
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader(mesh2);
+	reader.read("Data/session2.mli2",F|N);
+	EXPECT_EQ(7,mesh2.getNbNodes());
+	EXPECT_EQ(2,mesh2.getNbFaces());
+	EXPECT_DOUBLE_EQ(2.,mesh2.get<Node>(6).Z());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaAPITest,writeStaged) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh mesh(mod);
+
+	Node n1 = mesh.newNode(0,0,0);
+	Node n2 = mesh.newNode(1,0,0);
+	Node n3 = mesh.newNode(1,1,0);
+	mesh.newTriangle(n1,n2,n3);
+
+	LimaStager stager("Data/scratch",2);
+	WriterOptions options;
+	options.metadata = true;
+	GMDSCEAWriter writer(mesh);
+	writer.setOptions(options);
+	writer.setStaging(&stager);
+	writer.write("Data/staged.mli2",mod);
+	writer.write("Data/staged2.mli2",mod);
+	ASSERT_TRUE(stager.barrier());
+	EXPECT_EQ(0,stager.getNbPending());
+
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader(mesh2);
+	reader.read("Data/staged2.mli2",F|N);
+	EXPECT_EQ(3,mesh2.getNbNodes());
+	EXPECT_EQ(1,mesh2.getNbFaces());
+	MeshStatistics stats;
+	EXPECT_TRUE(MeshStatistics::probe("Data/staged.mli2",stats));
+
+	// a failed migration is reported and cleaned up
+	writer.write("Data/nodir/staged.mli2",mod);
+	EXPECT_FALSE(stager.barrier());
+	EXPECT_EQ(1,stager.getErrors().size());
+
+	glob_t staged;
+	EXPECT_NE(0,glob("Data/scratch/*",0,0,&staged));
+	globfree(&staged);
+}
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,232 @@
+/*----------------------------------------------------------------------------*/
+#include<string>
+/*----------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include <GMDSCEA/LimaReader.h>
+#include <GMDSCEA/LimaPartitionIndex.h>
+#include <GMDSCEA/LimaPartitionWriter.h>
+#include <GMDSCEA/LimaGatherWriter.h>
+#include <GMDSCEA/LimaMergeReader.h>
+#include <GMDSCEA/LimaMetaFile.h>
+#include <GMDSCEA/LimaVerifier.h>
+/*----------------------------------------------------------------------------*/
+using namespace gmds;
+/*----------------------------------------------------------------------------*/
+class LimaPartitionTest: public ::testing::Test {
+
+  protected:
+	LimaPartitionTest(){;}
+    virtual ~LimaPartitionTest(){;}
+
+    /* two quads sharing the edge x=1, one per partition */
+    void buildPartitions(IGMesh& AP0, IGMesh& AP1) {
+    	Node a0 = AP0.newNode(0,0,0);
+    	Node a1 = AP0.newNode(1,0,0);
+    	Node a2 = AP0.newNode(1,1,0);
+    	Node a3 = AP0.newNode(0,1,0);
+    	AP0.newQuad(a0,a1,a2,a3);
+    	AP0.newSurface("surf").add(AP0.get<Face>(0));
+
+    	Node b0 = AP1.newNode(1,0,0);
+    	Node b1 = AP1.newNode(2,0,0);
+    	Node b2 = AP1.newNode(2,1,0);
+    	Node b3 = AP1.newNode(1,1,0);
+    	AP1.newQuad(b0,b1,b2,b3);
+    	AP1.newSurface("surf").add(AP1.get<Face>(0));
+    }
+};
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaPartitionTest,writeIndex) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh p0(mod), p1(mod);
+	buildPartitions(p0,p1);
+
+	std::vector<IGMesh*> parts;
+	parts.push_back(&p0);
+	parts.push_back(&p1);
+
+	// the shared nodes get the same global id
+	std::vector<std::vector<TCellID> > globalIDs(2);
+	globalIDs[0].push_back(0);
+	globalIDs[0].push_back(1);
+	globalIDs[0].push_back(2);
+	globalIDs[0].push_back(3);
+	globalIDs[1].push_back(1);
+	globalIDs[1].push_back(4);
+	globalIDs[1].push_back(5);
+	globalIDs[1].push_back(2);
+
+	LimaPartitionWriter w(parts);
+	w.setNbWorkers(2);
+	w.setNodesGlobalIDs(globalIDs);
+	w.write("Data/parts",mod);
+
+	LimaPartitionIndex index;
+	index.read("Data/parts.idx");
+	EXPECT_EQ(2,index.getNbPartitions());
+	EXPECT_TRUE(index.hasGlobalNodeIDs());
+	EXPECT_EQ(1,index.getPartition(1).offsets[2]);
+	EXPECT_EQ("Data/parts_1.mli2",index.getPartitionPath(1));
+
+	IGMesh mesh(mod);
+	LimaReader<IGMesh> reader(mesh);
+	reader.read(index.getPartitionPath(1),F|N);
+	EXPECT_EQ(4,mesh.getNbNodes());
+	EXPECT_EQ(1,mesh.getNbFaces());
+
+	// a numbering that does not cover all the nodes is rejected
+	globalIDs[1].pop_back();
+	w.setNodesGlobalIDs(globalIDs);
+	EXPECT_THROW(w.write("Data/parts",mod),GMDSException);
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaPartitionTest,gather) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh p0(mod), p1(mod);
+	buildPartitions(p0,p1);
+
+	std::vector<IGMesh*> parts;
+	parts.push_back(&p0);
+	parts.push_back(&p1);
+
+	std::vector<std::vector<TCellID> > globalIDs(2);
+	globalIDs[0].push_back(0);
+	globalIDs[0].push_back(1);
+	globalIDs[0].push_back(2);
+	globalIDs[0].push_back(3);
+	globalIDs[1].push_back(1);
+	globalIDs[1].push_back(4);
+	globalIDs[1].push_back(5);
+	globalIDs[1].push_back(2);
+
+	LimaGatherWriter w(parts);
+	w.setNodesGlobalIDs(globalIDs);
+	w.write("Data/gather.mli2",mod);
+
+	IGMesh mesh(mod);
+	LimaReader<IGMesh> reader(mesh);
+	reader.read("Data/gather.mli2",F|N);
+	EXPECT_EQ(6,mesh.getNbNodes());
+	EXPECT_EQ(2,mesh.getNbFaces());
+	EXPECT_EQ(1,mesh.getNbSurfaces());
+	EXPECT_EQ(2,mesh.getSurface(0).size());
+
+	// only the dimensions of the model are written
+	w.write("Data/gather_nodes.mli2",DIM3|N);
+	IGMesh mesh2(mod);
+	LimaReader<IGMesh> reader2(mesh2);
+	reader2.read("Data/gather_nodes.mli2",F|N);
+	EXPECT_EQ(6,mesh2.getNbNodes());
+	EXPECT_EQ(0,mesh2.getNbFaces());
+
+	// the storage options are applied as by the other writers
+	WriterOptions options;
+	options.chunkSize = 4;
+	options.verify = true;
+	w.setOptions(options);
+	w.write("Data/gather.mli2",mod);
+	EXPECT_EQ(6,w.getStatistics().getNbNodes());
+	EXPECT_EQ(2,w.getStatistics().getNbCells(GMDS_QUAD));
+	EXPECT_EQ(2,w.getStatistics().getChunkChecksums(0).size());
+	LimaVerifier verifier;
+	EXPECT_TRUE(verifier.verify("Data/gather.mli2"));
+	w.setOptions(WriterOptions());
+	w.write("Data/gather.mli2",mod);
+	EXPECT_FALSE(LimaMetaFile().read("Data/gather.mli2"));
+
+	globalIDs[0].pop_back();
+	w.setNodesGlobalIDs(globalIDs);
+	EXPECT_THROW(w.write("Data/gather.mli2",mod),GMDSException);
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaPartitionTest,mergeByGlobalIDs) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh p0(mod), p1(mod);
+	buildPartitions(p0,p1);
+
+	std::vector<IGMesh*> parts;
+	parts.push_back(&p0);
+	parts.push_back(&p1);
+
+	std::vector<std::vector<TCellID> > globalIDs(2);
+	globalIDs[0].push_back(0);
+	globalIDs[0].push_back(1);
+	globalIDs[0].push_back(2);
+	globalIDs[0].push_back(3);
+	globalIDs[1].push_back(1);
+	globalIDs[1].push_back(4);
+	globalIDs[1].push_back(5);
+	globalIDs[1].push_back(2);
+
+	LimaPartitionWriter w(parts);
+	w.setNodesGlobalIDs(globalIDs);
+	w.write("Data/merge",mod);
+
+	IGMesh mesh(mod);
+	LimaMergeReader reader(mesh);
+	reader.setNbWorkers(2);
+	reader.read("Data/merge.idx",F|N);
+	EXPECT_EQ(6,mesh.getNbNodes());
+	EXPECT_EQ(2,mesh.getNbFaces());
+	EXPECT_EQ(1,mesh.getNbSurfaces());
+	EXPECT_EQ(2,mesh.getSurface(0).size());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaPartitionTest,mergeByCoordinates) {
+	MeshModel mod = DIM3|N|F|F2N;
+	IGMesh p0(mod), p1(mod);
+	buildPartitions(p0,p1);
+
+	std::vector<IGMesh*> parts;
+	parts.push_back(&p0);
+	parts.push_back(&p1);
+
+	LimaPartitionWriter w(parts);
+	w.write("Data/merge_coords",mod);
+
+	std::vector<std::string> files;
+	files.push_back(LimaPartitionWriter::getPartitionFileName("Data/merge_coords",0));
+	files.push_back(LimaPartitionWriter::getPartitionFileName("Data/merge_coords",1));
+
+	IGMesh mesh(mod);
+	LimaMergeReader reader(mesh);
+	reader.setTolerance(1e-6);
+	reader.read(files,F|N);
+	EXPECT_EQ(6,mesh.getNbNodes());
+	EXPECT_EQ(2,mesh.getNbFaces());
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(LimaPartitionTest,mergeInterface) {
+	MeshModel mod = DIM3|N|E|F|E2N|F2N;
+	IGMesh p0(mod), p1(mod);
+	buildPartitions(p0,p1);
+
+	// the interface edge and its group are in both partitions, not oriented
+	// the same way
+	p0.newLine("interface").add(p0.newEdge(p0.get<Node>(1),p0.get<Node>(2)));
+	p1.newLine("interface").add(p1.newEdge(p1.get<Node>(3),p1.get<Node>(0)));
+
+	std::vector<IGMesh*> parts;
+	parts.push_back(&p0);
+	parts.push_back(&p1);
+
+	LimaPartitionWriter w(parts);
+	w.write("Data/merge_interface",mod);
+
+	std::vector<std::string> files;
+	files.push_back(LimaPartitionWriter::getPartitionFileName("Data/merge_interface",0));
+	files.push_back(LimaPartitionWriter::getPartitionFileName("Data/merge_interface",1));
+
+	IGMesh mesh(mod);
+	LimaMergeReader reader(mesh);
+	reader.setTolerance(1e-6);
+	reader.read(files,E|F|N);
+	EXPECT_EQ(6,mesh.getNbNodes());
+	EXPECT_EQ(1,mesh.getNbEdges());
+	EXPECT_EQ(2,mesh.getNbFaces());
+	EXPECT_EQ(1,mesh.getNbLines());
+	EXPECT_EQ(1,mesh.getLine(0).size());
+}
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,54 @@
+/*----------------------------------------------------------------------------*/
+#include <cstdlib>
+#include <set>
+/*----------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+/*----------------------------------------------------------------------------*/
+#include <GMDSCEA/SpaceFillingCurve.h>
+/*----------------------------------------------------------------------------*/
+using namespace gmds;
+/*----------------------------------------------------------------------------*/
+class SpaceFillingCurveTest: public ::testing::Test {
+
+  protected:
+	SpaceFillingCurveTest(){;}
+    virtual ~SpaceFillingCurveTest(){;}
+};
+/*----------------------------------------------------------------------------*/
+TEST_F(SpaceFillingCurveTest,morton) {
+	EXPECT_EQ(0,SpaceFillingCurve::mortonKey(0,0,0));
+	EXPECT_EQ(1,SpaceFillingCurve::mortonKey(0,0,1));
+	EXPECT_EQ(2,SpaceFillingCurve::mortonKey(0,1,0));
+	EXPECT_EQ(4,SpaceFillingCurve::mortonKey(1,0,0));
+	EXPECT_EQ(7,SpaceFillingCurve::mortonKey(1,1,1));
+}
+/*----------------------------------------------------------------------------*/
+TEST_F(SpaceFillingCurveTest,hilbertAdjacency) {
+	// on a 8x8x8 grid, the Hilbert curve is a bijection whose consecutive
+	// points are neighbours
+	const uint32_t shift = SpaceFillingCurve::NB_BITS-3;
+	std::vector<uint64_t> keys;
+	std::vector<uint32_t> points;
+	for(uint32_t x=0; x<8; x++)
+		for(uint32_t y=0; y<8; y++)
+			for(uint32_t z=0; z<8; z++) {
+				keys.push_back(SpaceFillingCurve::hilbertKey(x<<shift,y<<shift,z<<shift));
+				points.push_back(x);
+				points.push_back(y);
+				points.push_back(z);
+			}
+
+	std::set<uint64_t> unique(keys.begin(),keys.end());
+	EXPECT_EQ(keys.size(),unique.size());
+
+	std::vector<std::size_t> order;
+	SpaceFillingCurve::sort(keys,order);
+	for(std::size_t i=1; i<order.size(); i++) {
+		int dist = 0;
+		for(int c=0; c<3; c++) {
+			dist += std::abs((int)points[3*order[i]+c]-(int)points[3*order[i-1]+c]);
+		}
+		EXPECT_EQ(1,dist);
+	}
+}
+/*----------------------------------------------------------------------------*/
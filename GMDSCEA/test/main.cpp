@@ -4,6 +4,9 @@
 // Files containing the different test suites to launch
 #include "LimaTest.h"
 #include "LimaAPITest.h"
+#include "LimaPartitionTest.h"
+#include "SpaceFillingCurveTest.h"
+#include "ConnectivityCodecTest.h"
 
 /*----------------------------------------------------------------------------*/
 int main(int argc, char ** argv) {
@@ -0,0 +1,416 @@
+/*----------------------------------------------------------------------------*/
+/** \file    GMDSCEAConvert.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ *
+ *  gmdscea-convert: batch conversion of Lima files (.mli, .unf, ...) to the
+ *  mli2 format on a pool of worker processes. Each file is streamed by a
+ *  LimaTranscoder, no gmds mesh is built.
+ *
+ *  gmdscea-convert [-j nb_workers] [-o output_dir] [-l list_file] files...
+ *
+ *  The files can be given as glob patterns. One line of JSON is printed on
+ *  the standard output for each file, followed by a summary line. The exit
+ *  status is 1 if any conversion failed, 2 if nothing was converted because
+ *  of the arguments: an output is one of the inputs or several inputs have
+ *  the same output.
+ */
+/*----------------------------------------------------------------------------*/
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <climits>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <glob.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include "GMDSCEA/LimaTranscoder.h"
+/*----------------------------------------------------------------------------*/
+using namespace gmds;
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+struct Worker {
+	pid_t pid;
+	/* read end of the pipe carrying the report of the worker */
+	int fd;
+	std::size_t file;
+	std::string report;
+};
+/*----------------------------------------------------------------------------*/
+std::string
+jsonString(const std::string& AString)
+{
+	std::ostringstream out;
+	out<<'"';
+	for(std::size_t i=0; i<AString.size(); i++) {
+		const char c = AString[i];
+		switch(c) {
+		case '"'  : out<<"\\\""; break;
+		case '\\' : out<<"\\\\"; break;
+		case '\n' : out<<"\\n";  break;
+		case '\t' : out<<"\\t";  break;
+		default :
+			if((unsigned char) c < 0x20) {
+				char buf[8];
+				std::snprintf(buf,sizeof(buf),"\\u%04x",(unsigned int) c);
+				out<<buf;
+			}
+			else {
+				out<<c;
+			}
+		}
+	}
+	out<<'"';
+	return out.str();
+}
+/*----------------------------------------------------------------------------*/
+long long
+fileSize(const std::string& AFileName)
+{
+	struct stat st;
+	if(stat(AFileName.c_str(),&st) != 0) {
+		return -1;
+	}
+	return st.st_size;
+}
+/*----------------------------------------------------------------------------*/
+std::string
+outputName(const std::string& AInput, const std::string& AOutputDir)
+{
+	std::string name = AInput;
+	std::string::size_type slash = name.find_last_of('/');
+	if(!AOutputDir.empty() && slash != std::string::npos) {
+		name = name.substr(slash+1);
+		slash = std::string::npos;
+	}
+	const std::string::size_type dot = name.find_last_of('.');
+	if(dot != std::string::npos && (slash == std::string::npos || dot > slash)) {
+		name = name.substr(0,dot);
+	}
+	name += ".mli2";
+	if(!AOutputDir.empty()) {
+		name = AOutputDir+"/"+name;
+	}
+	return name;
+}
+/*----------------------------------------------------------------------------*/
+/* absolute path of AFileName with its directory resolved, the file itself
+ * may not exist */
+std::string
+canonicalName(const std::string& AFileName)
+{
+	const std::string::size_type slash = AFileName.find_last_of('/');
+	const std::string dir = slash==std::string::npos?".":
+			(slash==0?"/":AFileName.substr(0,slash));
+	const std::string base = slash==std::string::npos?AFileName:AFileName.substr(slash+1);
+	char resolved[PATH_MAX];
+	if(realpath(dir.c_str(),resolved) == 0) {
+		return AFileName;
+	}
+	std::string name = resolved;
+	if(name != "/") {
+		name += '/';
+	}
+	return name+base;
+}
+/*----------------------------------------------------------------------------*/
+/* check that no input is overwritten and that each output is written by one
+ * conversion only, the conflicts are printed on the error output */
+bool
+checkOutputs(const std::vector<std::string>& AFiles, const std::vector<std::string>& AOutputs)
+{
+	// the inputs by name and, as a file can have several names, by inode
+	std::map<std::string, std::size_t> inputs;
+	std::map<std::pair<dev_t, ino_t>, std::size_t> inputNodes;
+	for(std::size_t i=0; i<AFiles.size(); i++) {
+		inputs.insert(std::make_pair(canonicalName(AFiles[i]),i));
+		struct stat st;
+		if(stat(AFiles[i].c_str(),&st) == 0) {
+			inputNodes.insert(std::make_pair(std::make_pair(st.st_dev,st.st_ino),i));
+		}
+	}
+
+	bool ok = true;
+	std::map<std::string, std::size_t> writers;
+	for(std::size_t i=0; i<AOutputs.size(); i++) {
+		const std::string name = canonicalName(AOutputs[i]);
+		std::map<std::string, std::size_t>::const_iterator input = inputs.find(name);
+		struct stat st;
+		if(input == inputs.end() && stat(AOutputs[i].c_str(),&st) == 0) {
+			std::map<std::pair<dev_t, ino_t>, std::size_t>::const_iterator node =
+					inputNodes.find(std::make_pair(st.st_dev,st.st_ino));
+			if(node != inputNodes.end()) {
+				input = inputs.find(canonicalName(AFiles[node->second]));
+			}
+		}
+		if(input != inputs.end()) {
+			std::cerr<<"GMDSCEA ERREUR : the conversion of "<<AFiles[i]
+					 <<" would overwrite the input "<<AFiles[input->second]<<std::endl;
+			ok = false;
+		}
+
+		const std::pair<std::map<std::string, std::size_t>::iterator, bool> it =
+				writers.insert(std::make_pair(name,i));
+		if(!it.second) {
+			std::cerr<<"GMDSCEA ERREUR : "<<AFiles[it.first->second]<<" and "<<AFiles[i]
+					 <<" are both converted to "<<AOutputs[i]<<std::endl;
+			ok = false;
+		}
+	}
+	return ok;
+}
+/*----------------------------------------------------------------------------*/
+void
+expand(const std::string& APattern, std::vector<std::string>& AFiles)
+{
+	glob_t matches;
+	if(glob(APattern.c_str(),0,0,&matches) == 0) {
+		for(std::size_t i=0; i<matches.gl_pathc; i++) {
+			AFiles.push_back(matches.gl_pathv[i]);
+		}
+	}
+	else {
+		// no match: kept so that the failure is reported
+		AFiles.push_back(APattern);
+	}
+	globfree(&matches);
+}
+/*----------------------------------------------------------------------------*/
+/* convert one file, returns its JSON report */
+std::string
+convert(const std::string& AInput, const std::string& AOutput)
+{
+	std::ostringstream report;
+	report<<"{\"type\":\"file\",\"input\":"<<jsonString(AInput)
+		  <<",\"output\":"<<jsonString(AOutput);
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	try {
+		LimaTranscoder transcoder;
+		transcoder.transcode(AInput,AOutput);
+
+		const double seconds = std::chrono::duration<double>(
+				std::chrono::steady_clock::now()-start).count();
+		const long long bytesIn = fileSize(AInput);
+		const long long bytesOut = fileSize(AOutput);
+
+		report<<",\"status\":\"ok\""
+			  <<",\"nodes\":"<<transcoder.getNbCells(0)
+			  <<",\"edges\":"<<transcoder.getNbCells(1)
+			  <<",\"faces\":"<<transcoder.getNbCells(2)
+			  <<",\"regions\":"<<transcoder.getNbCells(3)
+			  <<",\"bytes_in\":"<<bytesIn
+			  <<",\"bytes_out\":"<<bytesOut
+			  <<",\"seconds\":"<<seconds
+			  <<",\"mb_per_s\":"<<(seconds>0.?(bytesIn/1.e6)/seconds:0.)
+			  <<",\"cells_per_s\":"<<(seconds>0.?(transcoder.getNbCells(1)+
+					  transcoder.getNbCells(2)+transcoder.getNbCells(3))/seconds:0.);
+	}
+	catch(std::exception& e) {
+		const double seconds = std::chrono::duration<double>(
+				std::chrono::steady_clock::now()-start).count();
+		report<<",\"status\":\"error\",\"message\":"<<jsonString(e.what())
+			  <<",\"seconds\":"<<seconds;
+	}
+	catch(...) {
+		report<<",\"status\":\"error\",\"message\":\"unknown error\"";
+	}
+	report<<"}";
+	return report.str();
+}
+/*----------------------------------------------------------------------------*/
+/* wait for AWorker, whose report has been read, print the report and tell
+ * whether it succeeded */
+bool
+collect(const Worker& AWorker, const std::vector<std::string>& AFiles,
+		const std::string& AOutputDir)
+{
+	std::string report = AWorker.report;
+	close(AWorker.fd);
+
+	int status = 0;
+	while(waitpid(AWorker.pid,&status,0) < 0 && errno == EINTR) {}
+
+	if(report.empty()) {
+		// the worker died before reporting (signal, abort...)
+		std::ostringstream msg;
+		msg<<"{\"type\":\"file\",\"input\":"<<jsonString(AFiles[AWorker.file])
+		   <<",\"output\":"<<jsonString(outputName(AFiles[AWorker.file],AOutputDir))
+		   <<",\"status\":\"error\",\"message\":\"worker terminated";
+		if(WIFSIGNALED(status)) {
+			msg<<" by signal "<<WTERMSIG(status);
+		}
+		msg<<"\"}";
+		report = msg.str();
+	}
+	std::cout<<report<<std::endl;
+
+	return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+/*----------------------------------------------------------------------------*/
+void
+usage(const char* AProgram)
+{
+	std::cerr<<"usage: "<<AProgram
+			 <<" [-j nb_workers] [-o output_dir] [-l list_file] files..."<<std::endl;
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+	int nbWorkers = std::thread::hardware_concurrency();
+	std::string outputDir;
+	std::vector<std::string> files;
+
+	for(int i=1; i<argc; i++) {
+		const std::string arg = argv[i];
+		if((arg == "-j" || arg == "-o" || arg == "-l") && i+1 >= argc) {
+			usage(argv[0]);
+			return 2;
+		}
+		if(arg == "-j") {
+			nbWorkers = std::atoi(argv[++i]);
+		}
+		else if(arg == "-o") {
+			outputDir = argv[++i];
+		}
+		else if(arg == "-l") {
+			std::ifstream list(argv[++i]);
+			if(!list) {
+				std::cerr<<"cannot open "<<argv[i]<<std::endl;
+				return 2;
+			}
+			std::string line;
+			while(std::getline(list,line)) {
+				if(!line.empty() && line[0] != '#') {
+					expand(line,files);
+				}
+			}
+		}
+		else if(arg == "-h" || arg == "--help") {
+			usage(argv[0]);
+			return 0;
+		}
+		else {
+			expand(arg,files);
+		}
+	}
+	if(files.empty()) {
+		usage(argv[0]);
+		return 2;
+	}
+	if(nbWorkers <= 0) {
+		nbWorkers = 1;
+	}
+
+	std::vector<std::string> outputs(files.size());
+	for(std::size_t i=0; i<files.size(); i++) {
+		outputs[i] = outputName(files[i],outputDir);
+	}
+	if(!checkOutputs(files,outputs)) {
+		return 2;
+	}
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	// HDF5 is not thread-safe: each file is converted in a process forked
+	// from this one, so the libraries are loaded and initialized only once.
+	std::vector<Worker> running;
+	std::size_t next = 0;
+	std::size_t nbFailed = 0;
+	while(next < files.size() || !running.empty()) {
+		while(next < files.size() && (int) running.size() < nbWorkers) {
+			int fds[2];
+			if(pipe(fds) != 0) {
+				std::cerr<<"GMDSCEA ERREUR : unable to create a pipe"<<std::endl;
+				return 2;
+			}
+			std::cout.flush();
+			std::cerr.flush();
+			const pid_t pid = fork();
+			if(pid < 0) {
+				std::cerr<<"GMDSCEA ERREUR : unable to fork a worker process"<<std::endl;
+				return 2;
+			}
+			if(pid == 0) {
+				close(fds[0]);
+				const std::string report = convert(files[next],outputs[next]);
+				const bool ok = report.find("\"status\":\"ok\"") != std::string::npos;
+				std::size_t written = 0;
+				while(written < report.size()) {
+					const ssize_t nb = write(fds[1],report.data()+written,report.size()-written);
+					if(nb <= 0) {
+						break;
+					}
+					written += nb;
+				}
+				close(fds[1]);
+				_exit(ok?0:1);
+			}
+			close(fds[1]);
+			Worker w;
+			w.pid = pid;
+			w.fd = fds[0];
+			w.file = next;
+			running.push_back(w);
+			next++;
+		}
+
+		// the first worker to finish is collected, whatever its rank
+		std::vector<struct pollfd> polled(running.size());
+		for(std::size_t i=0; i<running.size(); i++) {
+			polled[i].fd = running[i].fd;
+			polled[i].events = POLLIN;
+			polled[i].revents = 0;
+		}
+		if(poll(&polled[0],polled.size(),-1) < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			std::cerr<<"GMDSCEA ERREUR : unable to wait for the worker processes"<<std::endl;
+			return 2;
+		}
+		for(std::size_t i=polled.size(); i-- > 0;) {
+			if(polled[i].revents == 0) {
+				continue;
+			}
+			char buf[4096];
+			const ssize_t nb = read(running[i].fd,buf,sizeof(buf));
+			if(nb > 0) {
+				running[i].report.append(buf,nb);
+			}
+			else if(nb == 0 || errno != EINTR) {
+				if(!collect(running[i],files,outputDir)) {
+					nbFailed++;
+				}
+				running.erase(running.begin()+i);
+			}
+		}
+	}
+
+	const double seconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now()-start).count();
+	std::cout<<"{\"type\":\"summary\",\"files\":"<<files.size()
+			 <<",\"failed\":"<<nbFailed
+			 <<",\"workers\":"<<nbWorkers
+			 <<",\"seconds\":"<<seconds<<"}"<<std::endl;
+
+	return nbFailed==0?0:1;
+}
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,96 @@
+/*----------------------------------------------------------------------------*/
+/** \file    GMDSCEADiff.cpp
+ *  \author  legoff
+ *  \date    19/10/2026
+ *
+ *  gmdscea-diff: comparison of two Lima files with a LimaDiff, no gmds mesh
+ *  is built.
+ *
+ *  gmdscea-diff [-t tolerance] [-n max_differences] [-j nb_threads] file1 file2
+ *
+ *  The first differences of each category are printed, followed by the
+ *  number of differences per category. The exit status is 0 if the files
+ *  are identical, 1 if they differ and 2 on error.
+ */
+/*----------------------------------------------------------------------------*/
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+#include <GMDS/IG/IG.h>
+#include "GMDSCEA/LimaDiff.h"
+/*----------------------------------------------------------------------------*/
+using namespace gmds;
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+void
+usage(const char* AProgram)
+{
+	std::cerr<<"usage: "<<AProgram
+			 <<" [-t tolerance] [-n max_differences] [-j nb_threads] file1 file2"<<std::endl;
+}
+/*----------------------------------------------------------------------------*/
+}  // namespace
+/*----------------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+	LimaDiff diff;
+	std::vector<std::string> files;
+
+	for(int i=1; i<argc; i++) {
+		const std::string arg = argv[i];
+		if((arg == "-t" || arg == "-n" || arg == "-j") && i+1 >= argc) {
+			usage(argv[0]);
+			return 2;
+		}
+		if(arg == "-t") {
+			diff.setTolerance(std::atof(argv[++i]));
+		}
+		else if(arg == "-n") {
+			diff.setMaxDifferences(std::strtoul(argv[++i],0,10));
+		}
+		else if(arg == "-j") {
+			diff.setNbThreads(std::atoi(argv[++i]));
+		}
+		else if(arg == "-h" || arg == "--help") {
+			usage(argv[0]);
+			return 0;
+		}
+		else {
+			files.push_back(arg);
+		}
+	}
+	if(files.size() != 2) {
+		usage(argv[0]);
+		return 2;
+	}
+
+	bool identical;
+	try {
+		identical = diff.compare(files[0],files[1]);
+	}
+	catch(GMDSException& e) {
+		std::cerr<<e.what()<<std::endl;
+		return 2;
+	}
+
+	const std::vector<LimaDifference>& differences = diff.getDifferences();
+	for(std::size_t i=0; i<differences.size(); i++) {
+		std::cout<<LimaDiff::getCategoryName(differences[i].category)<<": "
+				 <<differences[i].message<<std::endl;
+	}
+	for(int c=0; c<GMDSCEA_DIFF_NB_CATEGORIES; c++) {
+		const EDiffCategory category = static_cast<EDiffCategory>(c);
+		if(diff.getNbDifferences(category) > 0) {
+			std::cout<<diff.getNbDifferences(category)<<" "
+					 <<LimaDiff::getCategoryName(category)<<" difference(s)"<<std::endl;
+		}
+	}
+	if(identical) {
+		std::cout<<"identical"<<std::endl;
+	}
+	return identical?0:1;
+}
+/*----------------------------------------------------------------------------*/